@@ -0,0 +1,43 @@
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Batch.hpp"
+#include "Rover/Constant.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/Lift.hpp"
+#include "Rover/Range.hpp"
+#include "Benchmark.hpp"
+
+using namespace Rover;
+using namespace Rover::Benchmarks;
+
+namespace {
+  const auto COUNT = std::size_t(100000);
+
+  template<typename Generator>
+  void compare(const std::string& name, Generator& generator) {
+    using Type = typename Generator::Type;
+    auto values = std::vector<Type>(COUNT);
+    measure(name + " generate", 10, [&] {
+      auto evaluator = Evaluator();
+      for(auto& value : values) {
+        value = generate(generator, evaluator);
+      }
+      consume(values);
+    });
+    measure(name + " generate_batch", 10, [&] {
+      generate_batch(generator, values.size(), values.begin());
+      consume(values);
+    });
+  }
+}
+
+TEST_CASE("benchmark_batch", "[Batch]") {
+  auto constant = Constant(5);
+  compare("Constant", constant);
+  auto range = Range(0., 1.);
+  compare("Range", range);
+  auto lift = Lift([](double a, double b) {
+    return a * b;
+  }, Range(0., 1.), Range(1., 2.));
+  compare("Lift", lift);
+}
@@ -0,0 +1,57 @@
+#ifndef ROVER_BENCHMARK_HPP
+#define ROVER_BENCHMARK_HPP
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#if defined(_MSC_VER)
+  #include <intrin.h>
+#endif
+
+namespace Rover::Benchmarks {
+
+  //! Prevents the compiler from discarding the computation of a value.
+  /*!
+    \param value The value to keep.
+  */
+  template<typename T>
+  void consume(const T& value) {
+#if defined(_MSC_VER)
+    static const void* volatile sink;
+    sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "g"(&value) : "memory");
+#endif
+  }
+
+  //! Measures how many times per second a function can be called and prints
+  //! the result.
+  /*!
+    \param name The name of the measurement.
+    \param iterations The number of times to call the function.
+    \param function The function to measure.
+    \return The number of calls per second.
+  */
+  template<typename F>
+  double measure(const std::string& name, std::size_t iterations,
+      F&& function) {
+    function();
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = std::size_t(0); i < iterations; ++i) {
+      function();
+    }
+    auto elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+    auto throughput = iterations / elapsed;
+    std::cout << std::left << std::setw(48) << name << std::right <<
+      std::setw(16) << std::fixed << std::setprecision(0) << throughput <<
+      " /s" << std::setw(12) << std::setprecision(1) <<
+      1E9 * elapsed / iterations << " ns" << std::endl;
+    return throughput;
+  }
+}
+
+#endif
@@ -0,0 +1,89 @@
+#include <memory>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Box.hpp"
+#include "Rover/Constant.hpp"
+#include "Rover/Generator.hpp"
+#include "Benchmark.hpp"
+
+using namespace Rover;
+using namespace Rover::Benchmarks;
+
+namespace {
+
+  /** Pads a generator past Box's inline storage to force a heap
+      allocation, the layout every Box had before inline storage. */
+  template<typename G>
+  class Padded : public G {
+    public:
+      using G::G;
+
+    private:
+      char m_padding[Box<typename G::Type>::INLINE_SIZE];
+  };
+
+  class Sum {
+    public:
+      using Type = double;
+
+      explicit Sum(std::vector<Box<double>> children)
+        : m_children(std::move(children)) {}
+
+      Type generate(Evaluator& evaluator) {
+        auto sum = Type();
+        for(auto& child : m_children) {
+          sum += evaluator.evaluate(child);
+        }
+        return sum;
+      }
+
+    private:
+      std::vector<Box<double>> m_children;
+  };
+
+  template<typename G>
+  Sum make_sum(std::size_t size) {
+    auto children = std::vector<Box<double>>();
+    auto scatter = std::vector<std::unique_ptr<char[]>>();
+    for(auto i = std::size_t(0); i < size; ++i) {
+      children.emplace_back(G(static_cast<double>(i)));
+      scatter.push_back(std::make_unique<char[]>(256));
+    }
+    return Sum(std::move(children));
+  }
+}
+
+TEST_CASE("benchmark_box_construction", "[Box]") {
+  auto boxes = std::vector<Box<double>>();
+  boxes.reserve(1000);
+  measure("Construct 1000 inline Boxes", 1000, [&] {
+    boxes.clear();
+    for(auto i = 0; i < 1000; ++i) {
+      boxes.emplace_back(Constant(static_cast<double>(i)));
+    }
+    consume(boxes);
+  });
+  measure("Construct 1000 heap Boxes", 1000, [&] {
+    boxes.clear();
+    for(auto i = 0; i < 1000; ++i) {
+      boxes.emplace_back(Padded<Constant<double>>(static_cast<double>(i)));
+    }
+    consume(boxes);
+  });
+}
+
+TEST_CASE("benchmark_box", "[Box]") {
+  for(auto size : {100, 10000}) {
+    auto evaluator = Evaluator();
+    auto suffix = std::to_string(size) + " Boxes";
+    auto inline_sum = make_sum<Constant<double>>(size);
+    measure("Inline " + suffix, 1000000 / size, [&] {
+      consume(generate(inline_sum, evaluator));
+    });
+    auto heap_sum = make_sum<Padded<Constant<double>>>(size);
+    measure("Heap " + suffix, 1000000 / size, [&] {
+      consume(generate(heap_sum, evaluator));
+    });
+  }
+}
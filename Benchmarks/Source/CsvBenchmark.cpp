@@ -0,0 +1,89 @@
+#include <sstream>
+#include <string>
+#include <catch2/catch.hpp>
+#include "Rover/CsvParser.hpp"
+#include "Rover/ListTrial.hpp"
+#include "Rover/Sample.hpp"
+#include "Benchmark.hpp"
+
+using namespace Rover;
+using namespace Rover::Benchmarks;
+
+namespace {
+  const auto COUNT = std::size_t(200000);
+
+  auto make_numeric_trial() {
+    auto trial = ListTrial<Sample<double, double, int, float>>();
+    for(auto i = std::size_t(0); i != COUNT; ++i) {
+      trial.insert({ 0.001 * i - 3.7, { 1.0 / (i + 1),
+        static_cast<int>(i) - 100000, 0.5f * i } });
+    }
+    return trial;
+  }
+
+  auto make_text_trial() {
+    auto trial = ListTrial<Sample<int, std::string, std::string>>();
+    for(auto i = std::size_t(0); i != COUNT; ++i) {
+      trial.insert({ static_cast<int>(i), { "label " + std::to_string(i % 97),
+        "\"quoted\", " + std::to_string(i) } });
+    }
+    return trial;
+  }
+
+  template<typename Trial>
+  void run_reading(const std::string& name, const Trial& trial) {
+    auto sink = std::ostringstream();
+    save_to_csv(trial, sink);
+    auto csv = sink.str();
+    auto stream_rate = measure(name + " operator >>", 1, [&] {
+      auto source = std::istringstream(csv);
+      auto loaded = Trial();
+      while(source.good()) {
+        auto sample = typename Trial::Sample();
+        source >> sample;
+        if(source.good()) {
+          loaded.insert(std::move(sample));
+        }
+      }
+      consume(loaded);
+    });
+    auto reader_rate = measure(name + " load_from_csv", 5, [&] {
+      auto source = std::istringstream(csv);
+      auto loaded = Trial();
+      load_from_csv(source, loaded);
+      consume(loaded);
+    });
+    std::cout << name << " speedup " << reader_rate / stream_rate << "x, " <<
+      reader_rate * csv.size() / 1E6 << " MB/s" << std::endl;
+  }
+
+  template<typename Trial>
+  void run_writing(const std::string& name, const Trial& trial) {
+    auto size = std::size_t(0);
+    auto stream_rate = measure(name + " operator <<", 5, [&] {
+      auto sink = std::ostringstream();
+      for(auto& sample : trial) {
+        sink << sample << '\n';
+      }
+      consume(sink.str());
+    });
+    auto writer_rate = measure(name + " save_to_csv", 5, [&] {
+      auto sink = std::ostringstream();
+      save_to_csv(trial, sink);
+      size = sink.str().size();
+      consume(size);
+    });
+    std::cout << name << " speedup " << writer_rate / stream_rate << "x, " <<
+      writer_rate * size / 1E6 << " MB/s" << std::endl;
+  }
+}
+
+TEST_CASE("benchmark_csv_reading", "[Csv]") {
+  run_reading("numeric", make_numeric_trial());
+  run_reading("text", make_text_trial());
+}
+
+TEST_CASE("benchmark_csv_writing", "[Csv]") {
+  run_writing("numeric", make_numeric_trial());
+  run_writing("text", make_text_trial());
+}
@@ -0,0 +1,64 @@
+#include <cmath>
+#include <iterator>
+#include <random>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Batch.hpp"
+#include "Rover/Exponential.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/Lift.hpp"
+#include "Rover/LogUniform.hpp"
+#include "Rover/Normal.hpp"
+#include "Rover/Random.hpp"
+#include "Rover/Range.hpp"
+#include "Rover/TruncatedNormal.hpp"
+#include "Benchmark.hpp"
+
+using namespace Rover;
+using namespace Rover::Benchmarks;
+
+namespace {
+  const auto COUNT = std::size_t(1000000);
+
+  template<typename Generator>
+  void run(const std::string& name, Generator& generator) {
+    using Type = typename Generator::Type;
+    auto values = std::vector<Type>(COUNT);
+    auto evaluator = Evaluator();
+    measure(name + " generate", 5, [&] {
+      for(auto& value : values) {
+        value = generate(generator, evaluator);
+      }
+      consume(values);
+    });
+    measure(name + " batch", 5, [&] {
+      values.clear();
+      generate_batch(generator, COUNT, std::back_inserter(values));
+      consume(values);
+    });
+  }
+}
+
+TEST_CASE("benchmark_distributions", "[Distributions]") {
+  auto engine = DefaultEngine(next_seed());
+  auto values = std::vector<double>(COUNT);
+  measure("normal std::normal_distribution", 5, [&] {
+    auto distribution = std::normal_distribution<double>();
+    for(auto& value : values) {
+      value = distribution(engine);
+    }
+    consume(values);
+  });
+  auto normal = Normal(0., 1.);
+  run("normal", normal);
+  auto lifted = Lift([](double exponent) {
+    return std::exp(exponent);
+  }, Range(std::log(1E-6), std::log(1.)));
+  run("log-uniform Lift over Range", lifted);
+  auto log_uniform = LogUniform(1E-6, 1.);
+  run("log-uniform", log_uniform);
+  auto exponential = Exponential(1.);
+  run("exponential", exponential);
+  auto truncated = TruncatedNormal(0., 1., -1., 2.);
+  run("truncated normal", truncated);
+}
@@ -0,0 +1,150 @@
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Constant.hpp"
+#include "Rover/Evaluator.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/Lift.hpp"
+#include "Rover/Range.hpp"
+#include "Benchmark.hpp"
+
+using namespace Rover;
+using namespace Rover::Benchmarks;
+
+namespace {
+  template<typename G>
+  class Sum {
+    public:
+      using Type = typename G::Type;
+
+      explicit Sum(std::vector<G> children)
+        : m_children(std::move(children)) {}
+
+      Type generate(Evaluator& evaluator) {
+        auto sum = Type();
+        for(auto& child : m_children) {
+          sum += evaluator.evaluate(child);
+        }
+        return sum;
+      }
+
+    private:
+      std::vector<G> m_children;
+  };
+
+  auto make_graph(std::size_t size) {
+    auto children = std::vector<Range<Constant<int>, Constant<int>>>();
+    for(auto i = std::size_t(0); i < size; ++i) {
+      children.emplace_back(Constant(0), Constant(static_cast<int>(i)));
+    }
+    return Sum(std::move(children));
+  }
+
+  /** Hides a generator's static tree trait so that it is memoized. */
+  template<typename G>
+  class Memoized : public G {
+    public:
+      using G::G;
+  };
+
+  template<template<typename> class Node>
+  auto make_tree() {
+    auto leaf = [] {
+      return Node<Range<Constant<double>, Constant<double>>>(Constant(0.),
+        Constant(1.));
+    };
+    auto add = [](double a, double b, double c, double d) {
+      return a + b + c + d;
+    };
+    using Leaf = decltype(leaf());
+    using Branch = Node<Lift<decltype(add), Leaf, Leaf, Leaf, Leaf>>;
+    auto branch = [&] {
+      return Branch(add, leaf(), leaf(), leaf(), leaf());
+    };
+    return Node<Lift<decltype(add), Branch, Branch, Branch, Branch>>(add,
+      branch(), branch(), branch(), branch());
+  }
+
+  template<typename G>
+  using Unchanged = G;
+
+  template<typename G>
+  class PointerSum {
+    public:
+      using Type = typename G::Type;
+
+      explicit PointerSum(std::vector<G*> children)
+        : m_children(std::move(children)) {}
+
+      Type generate(Evaluator& evaluator) {
+        auto sum = Type();
+        for(auto child : m_children) {
+          sum += evaluator.evaluate(*child);
+        }
+        return sum;
+      }
+
+    private:
+      std::vector<G*> m_children;
+  };
+}
+
+TEST_CASE("benchmark_graph_size", "[Evaluator]") {
+  for(auto size : {10, 100, 1000, 10000}) {
+    auto graph = make_graph(size);
+    measure("Sample " + std::to_string(size) + " Ranges", 1000000 / size,
+      [&] {
+        consume(generate(graph));
+      });
+  }
+}
+
+TEST_CASE("benchmark_static_tree", "[Evaluator]") {
+  auto tree = make_tree<Unchanged>();
+  auto evaluator = Evaluator();
+  measure("Sample static tree of 16 Ranges", 1000000, [&] {
+    consume(generate(tree, evaluator));
+  });
+  auto memoized = make_tree<Memoized>();
+  measure("Sample memoized tree of 16 Ranges", 1000000, [&] {
+    consume(generate(memoized, evaluator));
+  });
+}
+
+TEST_CASE("benchmark_invalidate", "[Evaluator]") {
+  using Leaf = Range<Constant<double>, Constant<double>>;
+  using Branch = PointerSum<Leaf>;
+  auto leaves = std::vector<Leaf>();
+  for(auto i = 0; i < 1024; ++i) {
+    leaves.emplace_back(Constant(0.), Constant(1.));
+  }
+  auto branches = std::vector<Branch>();
+  for(auto i = 0; i < 32; ++i) {
+    auto children = std::vector<Leaf*>();
+    for(auto j = 0; j < 32; ++j) {
+      children.push_back(&leaves[32 * i + j]);
+    }
+    branches.emplace_back(std::move(children));
+  }
+  auto children = std::vector<Branch*>();
+  for(auto& branch : branches) {
+    children.push_back(&branch);
+  }
+  auto root = PointerSum<Branch>(std::move(children));
+  auto evaluator = Evaluator();
+  measure("Resample 1024 Ranges", 1000, [&] {
+    evaluator.reset();
+    consume(evaluator.evaluate(root));
+  });
+  evaluator.set_dependency_tracking(true);
+  measure("Resample 1024 Ranges tracking dependencies", 1000, [&] {
+    evaluator.reset();
+    consume(evaluator.evaluate(root));
+  });
+  auto i = std::size_t(0);
+  measure("Invalidate 1 of 1024 Ranges", 100000, [&] {
+    evaluator.invalidate(leaves[i % leaves.size()]);
+    consume(evaluator.evaluate(root));
+    ++i;
+  });
+}
@@ -0,0 +1,27 @@
+#include <catch2/catch.hpp>
+#include "Rover/Filter.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/Lift.hpp"
+#include "Rover/Range.hpp"
+#include "Benchmark.hpp"
+
+using namespace Rover;
+using namespace Rover::Benchmarks;
+
+TEST_CASE("benchmark_filter", "[Filter]") {
+  auto evaluator = Evaluator();
+  auto strict = Filter([](double x) {
+    return x < .05;
+  }, Range(0., 1.));
+  measure("Filter 5% acceptance", 1000000, [&] {
+    consume(generate(strict, evaluator));
+  });
+  auto lift = Filter([](double x) {
+    return x < .01;
+  }, Lift([](double x, double y) {
+    return x * y;
+  }, Range(0., 1.), Range(0., 1.)));
+  measure("Filter 5% acceptance over Lift", 1000000, [&] {
+    consume(generate(lift, evaluator));
+  });
+}
@@ -0,0 +1,83 @@
+#include <string>
+#include <tuple>
+#include <utility>
+#include <catch2/catch.hpp>
+#include "Rover/Constant.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/Pick.hpp"
+#include "Rover/Range.hpp"
+#include "Benchmark.hpp"
+
+using namespace Rover;
+using namespace Rover::Benchmarks;
+
+namespace {
+
+  /** Evaluates the element of a tuple chosen at runtime by comparing the
+      index against every position in turn, the dispatch Pick used before
+      its jump table. */
+  template<typename T, int I = std::tuple_size_v<T> - 1>
+  struct Ladder {
+    static auto evaluate(T& tuple, Evaluator& evaluator, int index) {
+      if(I == index) {
+        return evaluator.evaluate(std::get<I>(tuple));
+      } else {
+        return Ladder<T, I - 1>::evaluate(tuple, evaluator, index);
+      }
+    }
+  };
+
+  template<typename T>
+  struct Ladder<T, 0> {
+    static auto evaluate(T& tuple, Evaluator& evaluator, int) {
+      return evaluator.evaluate(std::get<0>(tuple));
+    }
+  };
+
+  template<typename C, typename... G>
+  class LadderPick {
+    public:
+      using Type = std::common_type_t<typename G::Type...>;
+
+      template<typename ChoiceFwd, typename... GeneratorsFwd>
+      LadderPick(ChoiceFwd&& choice, GeneratorsFwd&&... generators)
+        : m_choice(std::forward<ChoiceFwd>(choice)),
+          m_generators(std::forward<GeneratorsFwd>(generators)...) {}
+
+      Type generate(Evaluator& evaluator) {
+        return Ladder<std::tuple<G...>>::evaluate(m_generators, evaluator,
+          evaluator.evaluate(m_choice));
+      }
+
+    private:
+      C m_choice;
+      std::tuple<G...> m_generators;
+  };
+
+  template<template<typename...> class P, std::size_t... I>
+  auto make_pick(std::index_sequence<I...>) {
+    return P<Range<int, int>, decltype(Constant(static_cast<int>(I)))...>(
+      Range(0, static_cast<int>(sizeof...(I) - 1)),
+      Constant(static_cast<int>(I))...);
+  }
+
+  template<std::size_t N>
+  void measure_pick() {
+    auto evaluator = Evaluator();
+    auto suffix = std::to_string(N) + " alternatives";
+    auto ladder = make_pick<LadderPick>(std::make_index_sequence<N>());
+    measure("Ladder dispatch of " + suffix, 1000000, [&] {
+      consume(generate(ladder, evaluator));
+    });
+    auto pick = make_pick<Pick>(std::make_index_sequence<N>());
+    measure("Jump table dispatch of " + suffix, 1000000, [&] {
+      consume(generate(pick, evaluator));
+    });
+  }
+}
+
+TEST_CASE("benchmark_pick", "[Pick]") {
+  measure_pick<2>();
+  measure_pick<16>();
+  measure_pick<128>();
+}
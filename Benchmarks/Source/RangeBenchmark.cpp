@@ -0,0 +1,98 @@
+#include <cmath>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Generator.hpp"
+#include "Rover/Range.hpp"
+#include "Benchmark.hpp"
+
+using namespace Rover;
+using namespace Rover::Benchmarks;
+
+namespace {
+  const auto COUNT = std::size_t(100000);
+
+  /** Wraps an arithmetic value so that Range falls back to its rejection
+      loop, which is the loop used for every type before exact sampling. */
+  template<typename T>
+  struct Rejected {
+    T m_value;
+
+    Rejected() = default;
+
+    Rejected(T value)
+      : m_value(value) {}
+
+    friend Rejected operator +(Rejected left, Rejected right) {
+      return left.m_value + right.m_value;
+    }
+
+    friend Rejected operator -(Rejected left, Rejected right) {
+      return left.m_value - right.m_value;
+    }
+
+    friend Rejected operator *(double left, Rejected right) {
+      return static_cast<T>(left * right.m_value);
+    }
+
+    friend double operator /(Rejected left, T right) {
+      return static_cast<double>(left.m_value) / right;
+    }
+
+    friend Rejected abs(Rejected value) {
+      return std::abs(value.m_value);
+    }
+
+    friend bool operator ==(Rejected left, Rejected right) {
+      return left.m_value == right.m_value;
+    }
+
+    friend bool operator <(Rejected left, Rejected right) {
+      return left.m_value < right.m_value;
+    }
+
+    friend bool operator <=(Rejected left, Rejected right) {
+      return left.m_value <= right.m_value;
+    }
+
+    friend bool operator >(Rejected left, Rejected right) {
+      return left.m_value > right.m_value;
+    }
+
+    friend bool operator >=(Rejected left, Rejected right) {
+      return left.m_value >= right.m_value;
+    }
+  };
+
+  template<typename Generator>
+  void run(const std::string& name, Generator& generator) {
+    using Type = typename Generator::Type;
+    auto values = std::vector<Type>(COUNT);
+    auto evaluator = Evaluator();
+    measure(name, 10, [&] {
+      for(auto& value : values) {
+        value = generate(generator, evaluator);
+      }
+      consume(values);
+    });
+  }
+}
+
+TEST_CASE("benchmark_range", "[Range]") {
+  auto integer = Range(0, 9);
+  run("int [0, 9] exact", integer);
+  auto rejected_integer = Range(Rejected(0), Rejected(9));
+  run("int [0, 9] rejection", rejected_integer);
+  auto open = Range(0, 3, Interval::OPEN);
+  run("int (0, 3) exact", open);
+  auto rejected_open = Range(Rejected(0), Rejected(3), Interval::OPEN);
+  run("int (0, 3) rejection", rejected_open);
+  auto real = Range(0., 1.);
+  run("double [0, 1] exact", real);
+  auto rejected_real = Range(Rejected(0.), Rejected(1.));
+  run("double [0, 1] rejection", rejected_real);
+  auto granular = Range(0, 100, 25, Interval::RIGHT_EXCLUSIVE);
+  run("int [0, 100) by 25 exact", granular);
+  auto rejected_granular = Range(Rejected(0), Rejected(100), 25,
+    Interval::RIGHT_EXCLUSIVE);
+  run("int [0, 100) by 25 rejection", rejected_granular);
+}
@@ -0,0 +1,107 @@
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <catch2/catch.hpp>
+#include "Rover/BinaryCodec.hpp"
+#include "Rover/ColumnarTrial.hpp"
+#include "Rover/CsvParser.hpp"
+#include "Rover/FileTrial.hpp"
+#include "Rover/ListTrial.hpp"
+#include "Rover/MappedTrial.hpp"
+#include "Rover/Sample.hpp"
+#include "Benchmark.hpp"
+
+using namespace Rover;
+using namespace Rover::Benchmarks;
+
+namespace {
+  const auto COUNT = std::size_t(1000000);
+  using TrialSample = Sample<double, double, std::string, int>;
+
+  template<typename Trial>
+  Trial make_trial() {
+    auto trial = Trial();
+    trial.reserve(COUNT);
+    for(auto i = std::size_t(0); i != COUNT; ++i) {
+      trial.insert({ 0.5 * i, { 0.25 * i, "label", static_cast<int>(i) } });
+    }
+    return trial;
+  }
+}
+
+TEST_CASE("benchmark_trials", "[Trials]") {
+  auto list = make_trial<ListTrial<TrialSample>>();
+  auto columnar = make_trial<ColumnarTrial<TrialSample>>();
+  measure("ListTrial argument sum", 20, [&] {
+    auto sum = 0.;
+    for(auto i = std::size_t(0); i != list.size(); ++i) {
+      sum += std::get<0>(list[i].m_arguments);
+    }
+    consume(sum);
+  });
+  measure("ColumnarTrial argument column sum", 20, [&] {
+    const auto& column = columnar.get_arguments<0>();
+    auto sum = std::accumulate(column.begin(), column.end(), 0.);
+    consume(sum);
+  });
+  measure("ListTrial insert", 5, [&] {
+    consume(make_trial<ListTrial<TrialSample>>());
+  });
+  measure("ColumnarTrial insert", 5, [&] {
+    consume(make_trial<ColumnarTrial<TrialSample>>());
+  });
+}
+
+TEST_CASE("benchmark_trial_loading", "[Trials]") {
+  using LoadedSample = Sample<double, double, int>;
+  const auto csv_path = "trial_benchmark.csv";
+  const auto binary_path = "trial_benchmark.bin";
+  auto trial = ListTrial<LoadedSample>();
+  for(auto i = std::size_t(0); i != COUNT; ++i) {
+    trial.insert({ 0.5 * i, { 0.25 * i, static_cast<int>(i) } });
+  }
+  {
+    auto csv = std::ofstream(csv_path);
+    save_to_csv(trial, csv);
+    auto binary = std::ofstream(binary_path, std::ios::binary);
+    save_to_binary(trial, binary);
+  }
+  measure("load_from_csv", 1, [&] {
+    auto source = std::ifstream(csv_path);
+    auto loaded = ListTrial<LoadedSample>();
+    load_from_csv(source, loaded);
+    consume(loaded);
+  });
+  measure("load_from_binary", 5, [&] {
+    auto source = std::ifstream(binary_path, std::ios::binary);
+    auto loaded = ListTrial<LoadedSample>();
+    load_from_binary(source, loaded);
+    consume(loaded);
+  });
+  measure("MappedTrial open and scan", 5, [&] {
+    auto mapped = MappedTrial<LoadedSample>(binary_path);
+    auto sum = 0.;
+    for(auto& sample : mapped) {
+      sum += sample.m_result;
+    }
+    consume(sum);
+  });
+  const auto file_path = "trial_benchmark.chunks";
+  measure("FileTrial insert", 5, [&] {
+    std::remove(file_path);
+    auto file_trial = FileTrial<LoadedSample>(file_path);
+    file_trial.insert(trial.begin(), trial.end());
+  });
+  measure("FileTrial open and scan", 5, [&] {
+    auto file_trial = FileTrial<LoadedSample>(file_path);
+    auto sum = 0.;
+    for(auto i = std::size_t(0); i != file_trial.size(); ++i) {
+      sum += file_trial[i].m_result;
+    }
+    consume(sum);
+  });
+  std::remove(csv_path);
+  std::remove(binary_path);
+  std::remove(file_path);
+}
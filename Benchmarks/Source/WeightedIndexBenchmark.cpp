@@ -0,0 +1,29 @@
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Generator.hpp"
+#include "Rover/WeightedIndex.hpp"
+#include "Benchmark.hpp"
+
+using namespace Rover;
+using namespace Rover::Benchmarks;
+
+TEST_CASE("benchmark_weighted_index", "[WeightedIndex]") {
+  for(auto size : {16, 1024, 65536}) {
+    auto weights = std::vector<double>();
+    for(auto i = 0; i < size; ++i) {
+      weights.push_back(1. + i % 7);
+    }
+    auto index = WeightedIndex(std::move(weights));
+    auto evaluator = Evaluator();
+    auto suffix = std::to_string(size) + " weights";
+    measure("Sample " + suffix, 1000000, [&] {
+      consume(generate(index, evaluator));
+    });
+    auto i = 0;
+    measure("Update " + suffix, 10000, [&] {
+      index.set_weight(i % size, 1. + i % 5);
+      ++i;
+    });
+  }
+}
@@ -0,0 +1,260 @@
+#ifndef ROVER_ASYNC_TRIAL_RUNNER_HPP
+#define ROVER_ASYNC_TRIAL_RUNNER_HPP
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Rover/Evaluator.hpp"
+#include "Rover/ListTrial.hpp"
+#include "Rover/Random.hpp"
+#include "Rover/Sample.hpp"
+
+namespace Rover {
+namespace Details {
+  template<typename F, typename G>
+  struct async_runner_sample;
+
+  template<typename F, typename... G>
+  struct async_runner_sample<F, std::tuple<G...>> {
+    using Future = std::invoke_result_t<F&, const typename G::Type&...>;
+    using type = Sample<std::decay_t<decltype(std::declval<Future&>().get())>,
+      typename G::Type...>;
+  };
+
+  template<typename F, typename G>
+  using async_runner_sample_t = typename async_runner_sample<F, G>::type;
+}
+
+  //! The time an AsyncTrialRunner first waits on a single evaluation before
+  //! checking the others.
+  inline constexpr auto ASYNC_RUNNER_MIN_POLL_INTERVAL =
+    std::chrono::microseconds(50);
+
+  //! The longest time an AsyncTrialRunner waits on a single evaluation
+  //! before checking the others.
+  inline constexpr auto ASYNC_RUNNER_MAX_POLL_INTERVAL =
+    std::chrono::microseconds(4000);
+
+  //! Evaluates a function returning futures over arguments produced by
+  //! generators, keeping a bounded number of evaluations in flight.
+  /*!
+    \tparam B The type of the callable building the generators.
+    \tparam F The type of the function to evaluate, returning a future-like
+              object providing get() and wait_for(duration).
+    \details A single thread generates the arguments, launches the
+             evaluations and collects their results, so the function should
+             start its work asynchronously, for instance through std::async
+             or by talking to another process, and return immediately. While
+             every evaluation is in flight, the thread waits on the oldest
+             one for an interval doubling from ASYNC_RUNNER_MIN_POLL_INTERVAL
+             up to ASYNC_RUNNER_MAX_POLL_INTERVAL until a result is
+             collected.
+  */
+  template<typename B, typename F>
+  class AsyncTrialRunner {
+    public:
+
+      //! The type of the callable building the generators.
+      using Builder = B;
+
+      //! The tuple of generators returned by the builder.
+      using Generators = std::invoke_result_t<Builder&>;
+
+      //! The type of the function to evaluate.
+      using Function = F;
+
+      //! The type of the samples produced.
+      using Sample = Details::async_runner_sample_t<Function, Generators>;
+
+      //! The default type of trial storing the samples.
+      using Trial = ListTrial<Sample>;
+
+      //! Constructs an AsyncTrialRunner.
+      /*!
+        \param builder Callable returning a tuple of generators. It is called
+                       once per run within a SeedScope.
+        \param function The function to evaluate.
+        \param max_in_flight The largest number of evaluations started and
+                             not yet collected, at least one.
+        \details Up to max_in_flight arguments are generated ahead of time
+                 while waiting on the evaluations.
+      */
+      template<typename BuilderFwd, typename FunctionFwd>
+      AsyncTrialRunner(BuilderFwd&& builder, FunctionFwd&& function,
+        std::size_t max_in_flight);
+
+      //! Returns the largest number of evaluations in flight.
+      std::size_t max_in_flight() const;
+
+      //! Makes the arguments of the runs reproducible.
+      /*!
+        \param seed The seed from which the seed of every run is derived.
+      */
+      void seed(std::uint64_t seed);
+
+      //! Evaluates the function and inserts the samples into a trial.
+      /*!
+        \param count The number of evaluations.
+        \param trial The trial receiving the samples.
+        \details Samples are inserted in the order their evaluations
+                 complete. If an evaluation throws, no further evaluation is
+                 started, the evaluations in flight are waited on and their
+                 samples inserted, and the exception is rethrown.
+      */
+      template<typename T>
+      void run(std::size_t count, T& trial);
+
+      //! Evaluates the function and returns the samples in a new trial.
+      /*!
+        \param count The number of evaluations.
+      */
+      Trial run(std::size_t count);
+
+    private:
+      using Arguments = typename Sample::Arguments;
+      using Future =
+        typename Details::async_runner_sample<Function, Generators>::Future;
+      struct Evaluation {
+        Arguments m_arguments;
+        Future m_future;
+      };
+      Builder m_builder;
+      Function m_function;
+      std::size_t m_max_in_flight;
+      std::optional<std::uint64_t> m_seed;
+      std::uint64_t m_runs;
+  };
+
+  template<typename BuilderFwd, typename FunctionFwd>
+  AsyncTrialRunner(BuilderFwd&&, FunctionFwd&&, std::size_t) ->
+    AsyncTrialRunner<std::decay_t<BuilderFwd>, std::decay_t<FunctionFwd>>;
+
+  template<typename B, typename F>
+  template<typename BuilderFwd, typename FunctionFwd>
+  AsyncTrialRunner<B, F>::AsyncTrialRunner(BuilderFwd&& builder,
+    FunctionFwd&& function, std::size_t max_in_flight)
+    : m_builder(std::forward<BuilderFwd>(builder)),
+      m_function(std::forward<FunctionFwd>(function)),
+      m_max_in_flight(std::max(std::size_t(1), max_in_flight)),
+      m_runs(0) {}
+
+  template<typename B, typename F>
+  std::size_t AsyncTrialRunner<B, F>::max_in_flight() const {
+    return m_max_in_flight;
+  }
+
+  template<typename B, typename F>
+  void AsyncTrialRunner<B, F>::seed(std::uint64_t seed) {
+    m_seed = seed;
+    m_runs = 0;
+  }
+
+  template<typename B, typename F>
+  template<typename T>
+  void AsyncTrialRunner<B, F>::run(std::size_t count, T& trial) {
+    auto run_seed = [&] {
+      if(m_seed) {
+        return derive_seed(*m_seed, m_runs++);
+      }
+      return next_seed();
+    }();
+    auto generators = [&] {
+      auto scope = SeedScope(run_seed);
+      return std::invoke(m_builder);
+    }();
+    auto evaluator = Evaluator();
+    auto generated = std::size_t(0);
+    auto prepared = std::deque<Arguments>();
+    auto in_flight = std::deque<Evaluation>();
+    auto exception = std::exception_ptr();
+    auto poll_interval = ASYNC_RUNNER_MIN_POLL_INTERVAL;
+    auto fail = [&] {
+      if(!exception) {
+        exception = std::current_exception();
+      }
+    };
+    auto prepare = [&] {
+      evaluator.reset();
+      prepared.push_back(std::apply([&](auto&... generators) {
+        return Arguments(evaluator.evaluate(generators)...);
+      }, generators));
+      ++generated;
+    };
+    while(true) {
+      try {
+        while(!exception && in_flight.size() < m_max_in_flight) {
+          if(prepared.empty()) {
+            if(generated == count) {
+              break;
+            }
+            prepare();
+          }
+          auto future = std::apply([&](const auto&... arguments) {
+            return std::invoke(m_function, arguments...);
+          }, prepared.front());
+          in_flight.push_back(
+            Evaluation{std::move(prepared.front()), std::move(future)});
+          prepared.pop_front();
+        }
+      } catch(...) {
+        fail();
+      }
+      if(in_flight.empty()) {
+        break;
+      }
+      auto is_collected = false;
+      for(auto i = in_flight.begin(); i != in_flight.end();) {
+        if(i->m_future.wait_for(std::chrono::seconds(0)) ==
+            std::future_status::timeout) {
+          ++i;
+          continue;
+        }
+        try {
+          auto result = i->m_future.get();
+          trial.insert(Sample{std::move(result), std::move(i->m_arguments)});
+        } catch(...) {
+          fail();
+        }
+        i = in_flight.erase(i);
+        is_collected = true;
+      }
+      if(is_collected) {
+        poll_interval = ASYNC_RUNNER_MIN_POLL_INTERVAL;
+        continue;
+      }
+      if(!exception && generated != count &&
+          prepared.size() < m_max_in_flight) {
+        try {
+          prepare();
+        } catch(...) {
+          fail();
+        }
+        continue;
+      }
+      in_flight.front().m_future.wait_for(poll_interval);
+      poll_interval = std::min(2 * poll_interval,
+        ASYNC_RUNNER_MAX_POLL_INTERVAL);
+    }
+    if(exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  template<typename B, typename F>
+  typename AsyncTrialRunner<B, F>::Trial AsyncTrialRunner<B, F>::run(
+      std::size_t count) {
+    auto trial = Trial();
+    trial.reserve(count);
+    run(count, trial);
+    return trial;
+  }
+}
+
+#endif
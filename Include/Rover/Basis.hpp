@@ -2,11 +2,11 @@
 #define ROVER_BASIS_HPP
 #include <algorithm>
 #include <numeric>
-#include <random>
 #include <tuple>
 #include <variant>
 #include <vector>
 #include "Rover/Factor.hpp"
+#include "Rover/Random.hpp"
 #include "Rover/Sample.hpp"
 #include "Rover/ScalarView.hpp"
 #include "Rover/VariableTraits.hpp"
@@ -325,7 +325,7 @@ namespace Details {
         m_arguments(trial[0].m_arguments),
         m_to_negate(1 + m_arguments.size()) {
     auto order = std::vector<std::size_t>(trial.size());
-    auto generator = std::mt19937(std::random_device()());
+    auto generator = DefaultEngine(next_seed());
     auto factor_indexes = find_categorical(trial[0].m_arguments);
     std::iota(order.begin(), order.end(), std::size_t(0));
     for(auto i = std::size_t(0), last_factor_index = std::size_t(0); i <
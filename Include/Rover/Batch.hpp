@@ -0,0 +1,121 @@
+#ifndef ROVER_BATCH_HPP
+#define ROVER_BATCH_HPP
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Rover/Evaluator.hpp"
+
+namespace Rover {
+
+  //! Type trait indicating whether a generator can produce many independent
+  //! values at once through a member function
+  //! generate_batch(std::size_t count, OutputIterator out).
+  /*!
+    \tparam G The type of the generator.
+    \details Batchable generators only hold their sub-generators by value, so
+             no sub-generator can be shared with another part of a generator
+             graph.
+  */
+  template<typename G, typename = void>
+  struct is_batchable : std::false_type {};
+
+  template<typename G>
+  inline constexpr bool is_batchable_v = is_batchable<G>::value;
+
+  //! The number of values produced at once by the sub-generators of a
+  //! batchable generator.
+  inline constexpr auto BATCH_BLOCK_SIZE = std::size_t(256);
+
+  //! Produces many independent arguments from a generator.
+  /*!
+    \param generator The generator to evaluate.
+    \param count The number of arguments to produce.
+    \param out The output iterator receiving the arguments.
+    \return The output iterator past the last argument written.
+    \details Each argument is generated in its own session. Batchable
+             generators fill the output in a tight loop, other generators
+             reuse a single Evaluator.
+  */
+  template<typename Generator, typename OutputIterator>
+  OutputIterator generate_batch(Generator& generator, std::size_t count,
+    OutputIterator out);
+
+  //! Produces many independent arguments from several generators, where
+  //! the generators evaluated for a given row share the same session.
+  /*!
+    \param generators The generators to evaluate.
+    \param count The number of rows to produce.
+    \param outputs The output iterators receiving each generator's column.
+    \return The output iterators past the last arguments written.
+  */
+  template<typename... Generators, typename... OutputIterators>
+  std::tuple<OutputIterators...> generate_columns(
+    std::tuple<Generators&...> generators, std::size_t count,
+    std::tuple<OutputIterators...> outputs);
+
+namespace Details {
+
+  /** Buffers a block of values produced by a batchable sub-generator. */
+  template<typename G, typename = void>
+  class BatchColumn {
+    public:
+      using Type = typename G::Type;
+
+      void fill(G& generator, std::size_t count) {
+        m_values.clear();
+        Rover::generate_batch(generator, count, std::back_inserter(
+          m_values));
+      }
+
+      typename std::vector<Type>::const_reference operator [](
+          std::size_t index) const {
+        return m_values[index];
+      }
+
+    private:
+      std::vector<Type> m_values;
+  };
+
+  template<typename Generators, typename Outputs, std::size_t... I>
+  void generate_row(Evaluator& evaluator, Generators& generators,
+      Outputs& outputs, std::index_sequence<I...>) {
+    ((*std::get<I>(outputs) = evaluator.evaluate(std::get<I>(generators)),
+      ++std::get<I>(outputs)), ...);
+  }
+}
+
+  template<typename Generator, typename OutputIterator>
+  OutputIterator generate_batch(Generator& generator, std::size_t count,
+      OutputIterator out) {
+    if constexpr(is_batchable_v<Generator>) {
+      return generator.generate_batch(count, std::move(out));
+    } else {
+      auto evaluator = Evaluator();
+      for(auto i = std::size_t(0); i < count; ++i) {
+        evaluator.reset();
+        *out = evaluator.evaluate(generator);
+        ++out;
+      }
+      return out;
+    }
+  }
+
+  template<typename... Generators, typename... OutputIterators>
+  std::tuple<OutputIterators...> generate_columns(
+      std::tuple<Generators&...> generators, std::size_t count,
+      std::tuple<OutputIterators...> outputs) {
+    static_assert(sizeof...(Generators) == sizeof...(OutputIterators));
+    auto evaluator = Evaluator();
+    for(auto i = std::size_t(0); i < count; ++i) {
+      evaluator.reset();
+      Details::generate_row(evaluator, generators, outputs,
+        std::index_sequence_for<Generators...>());
+    }
+    return outputs;
+  }
+}
+
+#endif
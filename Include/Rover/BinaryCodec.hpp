@@ -0,0 +1,229 @@
+#ifndef ROVER_BINARY_CODEC_HPP
+#define ROVER_BINARY_CODEC_HPP
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Rover/Random.hpp"
+
+namespace Rover {
+
+  //! The version of the binary trial format.
+  inline constexpr auto BINARY_FORMAT_VERSION = std::uint32_t(1);
+
+  //! The offset of the first sample in a binary trial, which is also the
+  //! largest alignment a sample may require.
+  inline constexpr auto BINARY_DATA_OFFSET = std::size_t(64);
+
+namespace Details {
+  template<typename T>
+  struct are_trivially_copyable;
+
+  template<typename... T>
+  struct are_trivially_copyable<std::tuple<T...>> : std::bool_constant<
+    (std::is_trivially_copyable_v<T> && ...)> {};
+}
+
+  //! Type traits to check whether a Sample can be stored in the binary
+  //! format, which requires its result and arguments to be trivially
+  //! copyable.
+  template<typename S>
+  inline constexpr bool is_binary_sample_v =
+    std::is_trivially_copyable_v<typename S::Result> &&
+    Details::are_trivially_copyable<typename S::Arguments>::value &&
+    alignof(S) <= BINARY_DATA_OFFSET;
+
+  //! The header preceding the samples of a binary trial.
+  /*!
+    \details The samples follow the header at BINARY_DATA_OFFSET as the raw
+             bytes of the Sample type, so a file can only be read back on a
+             platform with the same layout. The schema fingerprints the kind,
+             size and offset of every field to detect any mismatch.
+  */
+  struct BinaryHeader {
+
+    //! Identifies the format, always "ROVERBIN".
+    char m_magic[8];
+
+    //! The version of the format.
+    std::uint32_t m_version;
+
+    //! Always 0x01020304 in the byte order of the writer.
+    std::uint32_t m_byte_order;
+
+    //! The size of a sample.
+    std::uint32_t m_sample_size;
+
+    //! The alignment of a sample.
+    std::uint32_t m_sample_alignment;
+
+    //! The fingerprint of the fields of a sample.
+    std::uint64_t m_schema;
+
+    //! The number of samples.
+    std::uint64_t m_count;
+
+    //! The offset of the first sample from the beginning of the header.
+    std::uint64_t m_data_offset;
+
+    //! Makes the header of a binary trial.
+    /*!
+      \tparam Sample The type of the samples.
+      \param count The number of samples.
+    */
+    template<typename Sample>
+    static BinaryHeader make(std::uint64_t count);
+
+    //! Checks the header against a Sample type.
+    /*!
+      \tparam Sample The type of the samples expected.
+      \param size The number of bytes available, including the header.
+      \throw std::runtime_error If the header does not describe samples of
+                                the expected type fitting within size bytes.
+    */
+    template<typename Sample>
+    void validate(std::uint64_t size) const;
+  };
+
+  static_assert(sizeof(BinaryHeader) <= BINARY_DATA_OFFSET);
+
+  //! Saves a trial to a binary stream.
+  /*!
+    \param trial The trial to save.
+    \param sink The output stream, which must be opened in binary mode.
+  */
+  template<typename Trial>
+  void save_to_binary(const Trial& trial, std::ostream& sink);
+
+  //! Loads a trial from a binary stream, discarding previously stored
+  //! samples.
+  /*!
+    \param source The input stream, which must be opened in binary mode.
+    \param trial The resulting trial.
+    \throw std::runtime_error If the stream does not hold a binary trial of
+                              the same Sample type.
+  */
+  template<typename Trial>
+  void load_from_binary(std::istream& source, Trial& trial);
+
+namespace Details {
+  template<typename T>
+  constexpr std::uint64_t get_field_kind() {
+    if constexpr(std::is_same_v<T, bool>) {
+      return 1;
+    } else if constexpr(std::is_floating_point_v<T>) {
+      return 2;
+    } else if constexpr(std::is_integral_v<T> && std::is_signed_v<T>) {
+      return 3;
+    } else if constexpr(std::is_integral_v<T>) {
+      return 4;
+    } else {
+      return 5;
+    }
+  }
+
+  template<typename T>
+  std::uint64_t fingerprint_field(std::uint64_t schema, const void* sample,
+      const T& field) {
+    auto offset = static_cast<std::uint64_t>(
+      reinterpret_cast<const unsigned char*>(&field) -
+      static_cast<const unsigned char*>(sample));
+    schema = mix_seed(schema ^ get_field_kind<T>());
+    schema = mix_seed(schema ^ sizeof(T));
+    return mix_seed(schema ^ offset);
+  }
+
+  template<typename Sample>
+  std::uint64_t fingerprint_sample() {
+    static const auto schema = [] {
+      auto sample = Sample();
+      auto schema = fingerprint_field(BINARY_FORMAT_VERSION, &sample,
+        sample.m_result);
+      std::apply([&](const auto&... arguments) {
+        ((schema = fingerprint_field(schema, &sample, arguments)), ...);
+      }, sample.m_arguments);
+      return schema;
+    }();
+    return schema;
+  }
+}
+
+  template<typename Sample>
+  BinaryHeader BinaryHeader::make(std::uint64_t count) {
+    static_assert(is_binary_sample_v<Sample>,
+      "The binary format requires trivially copyable fields.");
+    auto header = BinaryHeader();
+    std::memcpy(header.m_magic, "ROVERBIN", sizeof(header.m_magic));
+    header.m_version = BINARY_FORMAT_VERSION;
+    header.m_byte_order = 0x01020304;
+    header.m_sample_size = sizeof(Sample);
+    header.m_sample_alignment = alignof(Sample);
+    header.m_schema = Details::fingerprint_sample<Sample>();
+    header.m_count = count;
+    header.m_data_offset = BINARY_DATA_OFFSET;
+    return header;
+  }
+
+  template<typename Sample>
+  void BinaryHeader::validate(std::uint64_t size) const {
+    auto expected = make<Sample>(m_count);
+    if(std::memcmp(m_magic, expected.m_magic, sizeof(m_magic)) != 0) {
+      throw std::runtime_error("Not a binary trial.");
+    }
+    if(m_version != expected.m_version ||
+        m_byte_order != expected.m_byte_order) {
+      throw std::runtime_error("Unsupported binary trial version.");
+    }
+    if(m_sample_size != expected.m_sample_size ||
+        m_sample_alignment != expected.m_sample_alignment ||
+        m_schema != expected.m_schema ||
+        m_data_offset != expected.m_data_offset) {
+      throw std::runtime_error("Binary trial schema mismatch.");
+    }
+    if(size < m_data_offset ||
+        (size - m_data_offset) / m_sample_size < m_count) {
+      throw std::runtime_error("Binary trial is truncated.");
+    }
+  }
+
+  template<typename Trial>
+  void save_to_binary(const Trial& trial, std::ostream& sink) {
+    using Sample = typename Trial::Sample;
+    auto header = BinaryHeader::make<Sample>(trial.size());
+    auto padding = std::vector<char>(BINARY_DATA_OFFSET - sizeof(header));
+    sink.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    sink.write(padding.data(), padding.size());
+    for(auto& sample : trial) {
+      sink.write(reinterpret_cast<const char*>(&sample), sizeof(Sample));
+    }
+  }
+
+  template<typename Trial>
+  void load_from_binary(std::istream& source, Trial& trial) {
+    using Sample = typename Trial::Sample;
+    auto header = BinaryHeader();
+    source.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if(!source) {
+      throw std::runtime_error("Not a binary trial.");
+    }
+    header.validate<Sample>(std::numeric_limits<std::uint64_t>::max());
+    source.ignore(header.m_data_offset - sizeof(header));
+    auto result = Trial();
+    auto sample = Sample();
+    for(auto i = std::uint64_t(0); i != header.m_count; ++i) {
+      if(!source.read(reinterpret_cast<char*>(&sample), sizeof(Sample))) {
+        throw std::runtime_error("Binary trial is truncated.");
+      }
+      result.insert(sample);
+    }
+    trial = std::move(result);
+  }
+}
+
+#endif
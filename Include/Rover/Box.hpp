@@ -1,7 +1,9 @@
 #ifndef ROVER_BOX_HPP
 #define ROVER_BOX_HPP
-#include <memory>
+#include <cstddef>
+#include <new>
 #include <type_traits>
+#include <utility>
 #include "Rover/Evaluator.hpp"
 #include "Rover/Noncopyable.hpp"
 #include "Rover/Pointer.hpp"
@@ -11,6 +13,11 @@ namespace Rover {
   //! Provides type-erasure over generators evaluating to a type T.
   /*!
     \tparam T The type of value to generate.
+    \details Generators of at most INLINE_SIZE bytes whose move constructor
+             does not throw are stored within the Box, larger generators are
+             stored on the heap. Either way generate dispatches through a
+             table of function pointers shared by all Boxes holding the same
+             type of generator.
   */
   template<typename T>
   class Box final : private Noncopyable {
@@ -19,18 +26,27 @@ namespace Rover {
       //! The type of value to generate.
       using Type = T;
 
+      //! The size of the storage available for a generator within the Box.
+      static constexpr auto INLINE_SIZE = std::size_t(64);
+
       //! Packs a generator or generator pointer into a Box
       template<typename GeneratorFwd, std::enable_if_t<!std::is_convertible_v<
         std::decay_t<GeneratorFwd>, Box>>* = nullptr>
       explicit Box(GeneratorFwd&& gen);
 
+      Box(Box&& box) noexcept;
+
+      ~Box();
+
       Type generate(Evaluator& evaluator);
 
+      Box& operator =(Box&& box) noexcept;
+
     private:
-      class WrapperBase {
-        public:
-          virtual ~WrapperBase() = default;
-          virtual Type generate(Evaluator& evaluator) = 0;
+      struct Operations {
+        Type (*m_generate)(void* storage, Evaluator& evaluator);
+        void (*m_move)(void* source, void* destination) noexcept;
+        void (*m_destroy)(void* storage) noexcept;
       };
 
       template<typename>
@@ -39,34 +55,30 @@ namespace Rover {
       template<typename>
       class PointerWrapper;
 
-      std::unique_ptr<WrapperBase> m_generator;
+      template<typename Wrapper>
+      static constexpr bool is_inline_v = sizeof(Wrapper) <= INLINE_SIZE &&
+        alignof(Wrapper) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<Wrapper>;
+
+      template<typename Wrapper>
+      static const Operations INLINE_OPERATIONS;
+
+      template<typename Wrapper>
+      static const Operations HEAP_OPERATIONS;
+
+      const Operations* m_operations;
+      alignas(std::max_align_t) std::byte m_storage[INLINE_SIZE];
+
+      template<typename Wrapper, typename GeneratorFwd>
+      void emplace(GeneratorFwd&& gen);
   };
 
   template<typename GeneratorFwd>
   Box(GeneratorFwd&&) -> Box<generator_type_t<std::decay_t<GeneratorFwd>>>;
 
-  template<typename T>
-  template<typename GeneratorFwd, std::enable_if_t<!std::is_convertible_v<
-    std::decay_t<GeneratorFwd>, Box<T>>>*>
-  Box<T>::Box(GeneratorFwd&& gen)
-    : m_generator([&gen]() mutable {
-        if constexpr(is_object_pointer_v<std::decay_t<GeneratorFwd>>) {
-          return std::make_unique<PointerWrapper<std::decay_t<GeneratorFwd>>>(
-            std::forward<GeneratorFwd>(gen));
-        } else {
-          return std::make_unique<ValueWrapper<std::decay_t<GeneratorFwd>>>(
-            std::forward<GeneratorFwd>(gen));
-        }
-      }()) {}
-
-  template<typename T>
-  T Box<T>::generate(Evaluator& evaluator) {
-    return m_generator->generate(evaluator);
-  }
-
   template<typename T>
   template<typename Generator>
-  class Box<T>::ValueWrapper final : public WrapperBase {
+  class Box<T>::ValueWrapper {
     public:
 
       template<typename GeneratorFwd, std::enable_if_t<!std::is_convertible_v<
@@ -74,7 +86,7 @@ namespace Rover {
       ValueWrapper(GeneratorFwd&& gen)
         : m_generator(std::forward<GeneratorFwd>(gen)) {}
 
-      T generate(Evaluator& evaluator) override {
+      T generate(Evaluator& evaluator) {
         return evaluator.evaluate(m_generator);
       }
 
@@ -84,7 +96,7 @@ namespace Rover {
 
   template<typename T>
   template<typename Generator>
-  class Box<T>::PointerWrapper final : public WrapperBase {
+  class Box<T>::PointerWrapper {
     public:
 
       template<typename GeneratorFwd, std::enable_if_t<!std::is_convertible_v<
@@ -92,13 +104,105 @@ namespace Rover {
       PointerWrapper(GeneratorFwd&& gen)
         : m_generator(std::forward<GeneratorFwd>(gen)) {}
 
-      T generate(Evaluator& evaluator) override {
+      T generate(Evaluator& evaluator) {
         return evaluator.evaluate(*m_generator);
       }
 
     private:
       Generator m_generator;
   };
+
+  template<typename T>
+  template<typename Wrapper>
+  const typename Box<T>::Operations Box<T>::INLINE_OPERATIONS = {
+    [](void* storage, Evaluator& evaluator) -> T {
+      return static_cast<Wrapper*>(storage)->generate(evaluator);
+    },
+    [](void* source, void* destination) noexcept {
+      auto wrapper = static_cast<Wrapper*>(source);
+      new(destination) Wrapper(std::move(*wrapper));
+      wrapper->~Wrapper();
+    },
+    [](void* storage) noexcept {
+      static_cast<Wrapper*>(storage)->~Wrapper();
+    }
+  };
+
+  template<typename T>
+  template<typename Wrapper>
+  const typename Box<T>::Operations Box<T>::HEAP_OPERATIONS = {
+    [](void* storage, Evaluator& evaluator) -> T {
+      return (*static_cast<Wrapper**>(storage))->generate(evaluator);
+    },
+    [](void* source, void* destination) noexcept {
+      new(destination) Wrapper*(*static_cast<Wrapper**>(source));
+    },
+    [](void* storage) noexcept {
+      delete *static_cast<Wrapper**>(storage);
+    }
+  };
+
+  template<typename T>
+  template<typename GeneratorFwd, std::enable_if_t<!std::is_convertible_v<
+    std::decay_t<GeneratorFwd>, Box<T>>>*>
+  Box<T>::Box(GeneratorFwd&& gen) {
+    if constexpr(is_object_pointer_v<std::decay_t<GeneratorFwd>>) {
+      emplace<PointerWrapper<std::decay_t<GeneratorFwd>>>(
+        std::forward<GeneratorFwd>(gen));
+    } else {
+      emplace<ValueWrapper<std::decay_t<GeneratorFwd>>>(
+        std::forward<GeneratorFwd>(gen));
+    }
+  }
+
+  template<typename T>
+  Box<T>::Box(Box&& box) noexcept
+      : m_operations(box.m_operations) {
+    if(m_operations) {
+      m_operations->m_move(box.m_storage, m_storage);
+      box.m_operations = nullptr;
+    }
+  }
+
+  template<typename T>
+  Box<T>::~Box() {
+    if(m_operations) {
+      m_operations->m_destroy(m_storage);
+    }
+  }
+
+  template<typename T>
+  T Box<T>::generate(Evaluator& evaluator) {
+    return m_operations->m_generate(m_storage, evaluator);
+  }
+
+  template<typename T>
+  Box<T>& Box<T>::operator =(Box&& box) noexcept {
+    if(this == &box) {
+      return *this;
+    }
+    if(m_operations) {
+      m_operations->m_destroy(m_storage);
+    }
+    m_operations = box.m_operations;
+    if(m_operations) {
+      m_operations->m_move(box.m_storage, m_storage);
+      box.m_operations = nullptr;
+    }
+    return *this;
+  }
+
+  template<typename T>
+  template<typename Wrapper, typename GeneratorFwd>
+  void Box<T>::emplace(GeneratorFwd&& gen) {
+    if constexpr(is_inline_v<Wrapper>) {
+      new(m_storage) Wrapper(std::forward<GeneratorFwd>(gen));
+      m_operations = &INLINE_OPERATIONS<Wrapper>;
+    } else {
+      new(m_storage) Wrapper*(new Wrapper(std::forward<GeneratorFwd>(gen)));
+      m_operations = &HEAP_OPERATIONS<Wrapper>;
+    }
+  }
 }
 
 #endif
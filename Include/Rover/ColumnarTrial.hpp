@@ -0,0 +1,176 @@
+#ifndef ROVER_COLUMNAR_TRIAL_HPP
+#define ROVER_COLUMNAR_TRIAL_HPP
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "Rover/Sample.hpp"
+#include "Rover/TrialIterator.hpp"
+
+namespace Rover {
+
+  //! Stores samples in RAM as one array per field.
+  /*!
+    \tparam S The type of the samples.
+  */
+  template<typename S>
+  class ColumnarTrial;
+
+  //! Stores samples in RAM as one array per field.
+  /*!
+    \tparam R The type of the result.
+    \tparam A The types of the arguments.
+    \details The results and each argument are kept in their own contiguous
+             array so that a single field can be read sequentially without
+             striding over the others. Samples are materialized on access,
+             which makes the iterator an input iterator.
+  */
+  template<typename R, typename... A>
+  class ColumnarTrial<Sample<R, A...>> {
+    public:
+
+      //! The type of stored samples.
+      using Sample = Rover::Sample<R, A...>;
+
+      //! The type of the result.
+      using Result = typename Sample::Result;
+
+      //! The type of the arguments.
+      using Arguments = typename Sample::Arguments;
+
+      //! The type of the array storing the argument at an index.
+      template<std::size_t I>
+      using ArgumentColumn = std::vector<std::tuple_element_t<I, Arguments>>;
+
+      //! The type of the constant iterator.
+      using Iterator = TrialIterator<ColumnarTrial>;
+
+      //! Increases the capacity of the underlying arrays.
+      void reserve(std::size_t capacity);
+
+      //! Inserts a sample to this trial.
+      void insert(const Sample& s);
+
+      //! Inserts a sample to this trial.
+      void insert(Sample&& s);
+
+      //! Inserts all samples from a collection via iterators to this one.
+      template<typename Begin, typename End>
+      void insert(Begin b, End e);
+
+      //! Returns a constant iterator to the first sample
+      Iterator begin() const;
+
+      //! Returns a constant iterator to the past-the-end sample
+      Iterator end() const;
+
+      //! Number of samples in this trial.
+      std::size_t size() const;
+
+      //! Number of samples that can be stored without re-allocations
+      std::size_t capacity() const;
+
+      //! Returns a copy of a sample.
+      Sample operator [](std::size_t index) const;
+
+      //! Returns the results of every sample, in order of insertion.
+      const std::vector<Result>& get_results() const;
+
+      //! Returns an argument of every sample, in order of insertion.
+      /*!
+        \tparam I The index of the argument.
+      */
+      template<std::size_t I>
+      const ArgumentColumn<I>& get_arguments() const;
+
+    private:
+      std::vector<Result> m_results;
+      std::tuple<std::vector<A>...> m_arguments;
+  };
+
+  template<typename R, typename... A>
+  void ColumnarTrial<Sample<R, A...>>::reserve(std::size_t capacity) {
+    m_results.reserve(capacity);
+    std::apply([&](auto&... columns) {
+      (columns.reserve(capacity), ...);
+    }, m_arguments);
+  }
+
+  template<typename R, typename... A>
+  void ColumnarTrial<Sample<R, A...>>::insert(const Sample& s) {
+    m_results.push_back(s.m_result);
+    std::apply([&](auto&... columns) {
+      std::apply([&](const auto&... arguments) {
+        (columns.push_back(arguments), ...);
+      }, s.m_arguments);
+    }, m_arguments);
+  }
+
+  template<typename R, typename... A>
+  void ColumnarTrial<Sample<R, A...>>::insert(Sample&& s) {
+    m_results.push_back(std::move(s.m_result));
+    std::apply([&](auto&... columns) {
+      std::apply([&](auto&... arguments) {
+        (columns.push_back(std::move(arguments)), ...);
+      }, s.m_arguments);
+    }, m_arguments);
+  }
+
+  template<typename R, typename... A>
+  template<typename Begin, typename End>
+  void ColumnarTrial<Sample<R, A...>>::insert(Begin b, End e) {
+    for(; b != e; ++b) {
+      insert(*b);
+    }
+  }
+
+  template<typename R, typename... A>
+  typename ColumnarTrial<Sample<R, A...>>::Iterator
+      ColumnarTrial<Sample<R, A...>>::begin() const {
+    return Iterator(*this, 0);
+  }
+
+  template<typename R, typename... A>
+  typename ColumnarTrial<Sample<R, A...>>::Iterator
+      ColumnarTrial<Sample<R, A...>>::end() const {
+    return Iterator(*this, size());
+  }
+
+  template<typename R, typename... A>
+  std::size_t ColumnarTrial<Sample<R, A...>>::size() const {
+    return m_results.size();
+  }
+
+  template<typename R, typename... A>
+  std::size_t ColumnarTrial<Sample<R, A...>>::capacity() const {
+    auto capacity = m_results.capacity();
+    std::apply([&](const auto&... columns) {
+      ((capacity = std::min(capacity, columns.capacity())), ...);
+    }, m_arguments);
+    return capacity;
+  }
+
+  template<typename R, typename... A>
+  typename ColumnarTrial<Sample<R, A...>>::Sample
+      ColumnarTrial<Sample<R, A...>>::operator [](std::size_t index) const {
+    return std::apply([&](const auto&... columns) {
+      return Sample{m_results[index], Arguments(columns[index]...)};
+    }, m_arguments);
+  }
+
+  template<typename R, typename... A>
+  const std::vector<typename ColumnarTrial<Sample<R, A...>>::Result>&
+      ColumnarTrial<Sample<R, A...>>::get_results() const {
+    return m_results;
+  }
+
+  template<typename R, typename... A>
+  template<std::size_t I>
+  const typename ColumnarTrial<Sample<R, A...>>::template ArgumentColumn<I>&
+      ColumnarTrial<Sample<R, A...>>::get_arguments() const {
+    return std::get<I>(m_arguments);
+  }
+}
+
+#endif
@@ -1,6 +1,9 @@
 #ifndef ROVER_CONSTANT_HPP
 #define ROVER_CONSTANT_HPP
+#include <algorithm>
+#include <optional>
 #include <utility>
+#include "Rover/Batch.hpp"
 #include "Rover/Evaluator.hpp"
 
 namespace Rover {
@@ -18,6 +21,16 @@ namespace Rover {
 
       constexpr Type generate(Evaluator& evaluator) const;
 
+      //! Writes copies of the constant to an output iterator.
+      /*!
+        \param count The number of copies to write.
+        \param out The output iterator.
+        \return The output iterator past the last copy written.
+      */
+      template<typename OutputIterator>
+      OutputIterator generate_batch(std::size_t count, OutputIterator out)
+        const;
+
     private:
       Type m_value;
   };
@@ -31,6 +44,41 @@ namespace Rover {
       Evaluator& evaluator) const {
     return m_value;
   }
+
+  template<typename T>
+  template<typename OutputIterator>
+  OutputIterator Constant<T>::generate_batch(std::size_t count,
+      OutputIterator out) const {
+    return std::fill_n(std::move(out), count, m_value);
+  }
+
+  template<typename T>
+  struct is_batchable<Constant<T>> : std::true_type {};
+
+  template<typename T>
+  struct is_static_tree<Constant<T>> : std::true_type {};
+
+namespace Details {
+  template<typename T>
+  class BatchColumn<Constant<T>> {
+    public:
+      using Type = T;
+
+      void fill(Constant<T>& generator, std::size_t) {
+        if(!m_value) {
+          auto evaluator = Evaluator();
+          m_value.emplace(generator.generate(evaluator));
+        }
+      }
+
+      const Type& operator [](std::size_t) const {
+        return *m_value;
+      }
+
+    private:
+      std::optional<Type> m_value;
+  };
+}
 }
 
 #endif
@@ -1,6 +1,8 @@
 #ifndef ROVER_CSV_PARSER_HPP
 #define ROVER_CSV_PARSER_HPP
 #include <iostream>
+#include "Rover/CsvReader.hpp"
+#include "Rover/CsvWriter.hpp"
 
 namespace Rover {
 
@@ -8,6 +10,8 @@ namespace Rover {
   /*!
     \param Trial The trial to save.
     \param sink The output stream.
+    \details The trial is written with a CsvWriter, so floating point
+             results and arguments load back to the same values.
   */
   template<typename Trial>
   void save_to_csv(const Trial& trial, std::ostream& sink);
@@ -16,27 +20,31 @@ namespace Rover {
   /*!
     \param source The input stream containing a CSV-encoded trial.
     \param trial The resulting trial.
+    \details The source is read with a CsvReader. Samples with a field that
+             fails to parse are skipped, as is a last sample not followed by
+             a delimiter.
   */
   template<typename Trial>
   void load_from_csv(std::istream& source, Trial& trial);
 
   template<typename Trial>
   void save_to_csv(const Trial& trial, std::ostream& sink) {
+    auto writer = CsvWriter(sink);
     for(auto& sample : trial) {
-      sink << sample << '\n';
+      writer.write(sample);
     }
   }
 
   template<typename Trial>
   void load_from_csv(std::istream& source, Trial& trial) {
     auto result = Trial();
-    while(source.good()) {
-      auto sample = typename Trial::Sample();
-      source >> sample;
-      if(source.good()) {
+    auto reader = CsvReader(source);
+    auto sample = typename Trial::Sample();
+    while(!reader.is_exhausted()) {
+      if(reader.read(sample)) {
         result.insert(std::move(sample));
       }
-    };
+    }
     trial = std::move(result);
   }
 }
@@ -0,0 +1,309 @@
+#ifndef ROVER_CSV_READER_HPP
+#define ROVER_CSV_READER_HPP
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "Rover/Sample.hpp"
+
+namespace Rover {
+
+  //! The default number of bytes read at once by a CsvReader.
+  inline constexpr auto CSV_BUFFER_SIZE = std::size_t(1) << 16;
+
+  //! Reads samples from a CSV in large blocks, parsing fields in place.
+  /*!
+    \details Fields are delimited and quoted as by get_next_cvs_field: a
+             field ends at ',', '\n' or '\0', and a field starting with '"'
+             extends to the next lone '"', with '""' standing for '"'. A
+             quoted field followed by anything but a delimiter is invalid up
+             to the next delimiter.
+             Delimiters are found eight bytes at a time and quoted fields
+             are unescaped within the buffer, so no field allocates. Numbers
+             are parsed with std::from_chars, strings are copied from the
+             buffer, and other types fall back to operator >>.
+  */
+  class CsvReader {
+    public:
+
+      //! Constructs a CsvReader.
+      /*!
+        \param source The input stream, which the reader consumes in blocks.
+        \param buffer_size The number of bytes read at once. The buffer grows
+                           as needed to hold a field.
+      */
+      explicit CsvReader(std::istream& source,
+        std::size_t buffer_size = CSV_BUFFER_SIZE);
+
+      //! Returns whether the whole source has been consumed.
+      bool is_exhausted() const;
+
+      //! Reads the fields of the next sample.
+      /*!
+        \param sample The sample receiving the result and the arguments.
+        \return Whether every field was parsed and the last one was followed
+                by a delimiter. Otherwise the sample is left partially
+                updated.
+      */
+      template<typename S>
+      bool read(S& sample);
+
+    private:
+      struct Field {
+        std::string_view m_value;
+        bool m_is_valid;
+        bool m_is_terminated;
+      };
+      std::istream* m_source;
+      std::vector<char> m_buffer;
+      std::size_t m_position;
+      std::size_t m_size;
+      bool m_is_source_exhausted;
+      bool m_is_exhausted;
+
+      std::size_t refill(std::size_t begin);
+      bool is_available(std::size_t& position, std::size_t& begin);
+      Field read_field();
+      Field read_quoted_field();
+  };
+
+namespace Details {
+  inline bool is_csv_delimiter(char c) {
+    return c == ',' || c == '\n' || c == '\0';
+  }
+
+  inline std::size_t find_csv_delimiter(const char* data, std::size_t begin,
+      std::size_t end) {
+    constexpr auto ONES = std::uint64_t(0x0101010101010101ULL);
+    constexpr auto HIGHS = std::uint64_t(0x8080808080808080ULL);
+    auto has_zero = [](std::uint64_t word) {
+      return (word - ONES) & ~word & HIGHS;
+    };
+    auto i = begin;
+    for(; i + sizeof(std::uint64_t) <= end; i += sizeof(std::uint64_t)) {
+      auto word = std::uint64_t();
+      std::memcpy(&word, data + i, sizeof(word));
+      if(has_zero(word) | has_zero(word ^ (ONES * ',')) |
+          has_zero(word ^ (ONES * '\n'))) {
+        break;
+      }
+    }
+    for(; i != end; ++i) {
+      if(is_csv_delimiter(data[i])) {
+        return i;
+      }
+    }
+    return end;
+  }
+
+  inline std::string_view trim_csv_field(std::string_view field) {
+    auto i = field.find_first_not_of(" \t\n\v\f\r");
+    if(i == std::string_view::npos) {
+      return {};
+    }
+    return field.substr(i);
+  }
+
+  template<typename T>
+  inline constexpr bool is_csv_character_v = std::is_same_v<T, char> ||
+    std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>;
+
+  template<typename T>
+  bool parse_csv_number(std::string_view field, T& value) {
+    field = trim_csv_field(field);
+    if(field.empty()) {
+      value = T();
+      return true;
+    }
+    if(field.size() > 1 && field[0] == '+' && field[1] != '+' &&
+        field[1] != '-') {
+      field.remove_prefix(1);
+    }
+    auto result = T();
+    if(std::from_chars(field.data(), field.data() + field.size(),
+        result).ec != std::errc()) {
+      return false;
+    }
+    value = result;
+    return true;
+  }
+
+  template<typename T>
+  bool parse_csv_field(std::string_view field, T& value) {
+    if constexpr(std::is_same_v<T, std::string>) {
+      value.assign(field.data(), field.size());
+      return true;
+    } else if constexpr(is_csv_character_v<T>) {
+      field = trim_csv_field(field);
+      value = field.empty() ? T() : static_cast<T>(field[0]);
+      return true;
+    } else if constexpr(std::is_same_v<T, bool>) {
+      auto integer = 0;
+      if(!parse_csv_number(field, integer) || (integer != 0 &&
+          integer != 1)) {
+        return false;
+      }
+      value = integer == 1;
+      return true;
+    } else if constexpr(std::is_arithmetic_v<T>) {
+      return parse_csv_number(field, value);
+    } else {
+      auto stream = std::istringstream(std::string(field));
+      auto result = T();
+      read_argument(stream, result);
+      if(stream || stream.eof()) {
+        value = std::move(result);
+        return true;
+      }
+      return false;
+    }
+  }
+}
+
+  inline CsvReader::CsvReader(std::istream& source, std::size_t buffer_size)
+    : m_source(&source),
+      m_buffer(std::max(std::size_t(1), buffer_size)),
+      m_position(0),
+      m_size(0),
+      m_is_source_exhausted(false),
+      m_is_exhausted(false) {}
+
+  inline bool CsvReader::is_exhausted() const {
+    return m_is_exhausted;
+  }
+
+  template<typename S>
+  bool CsvReader::read(S& sample) {
+    auto is_valid = true;
+    auto parse = [&](auto& value) {
+      auto field = read_field();
+      is_valid = field.m_is_valid &&
+        Details::parse_csv_field(field.m_value, value) && is_valid;
+      return field.m_is_terminated;
+    };
+    auto is_terminated = parse(sample.m_result) &&
+      std::apply([&](auto&... arguments) {
+        return (parse(arguments) && ...);
+      }, sample.m_arguments);
+    return is_valid && is_terminated;
+  }
+
+  inline std::size_t CsvReader::refill(std::size_t begin) {
+    std::memmove(m_buffer.data(), m_buffer.data() + begin, m_size - begin);
+    m_size -= begin;
+    if(m_size == m_buffer.size()) {
+      m_buffer.resize(2 * m_buffer.size());
+    }
+    m_source->read(m_buffer.data() + m_size, m_buffer.size() - m_size);
+    auto count = static_cast<std::size_t>(m_source->gcount());
+    if(count == 0) {
+      m_is_source_exhausted = true;
+    }
+    m_size += count;
+    return begin;
+  }
+
+  inline bool CsvReader::is_available(std::size_t& position,
+      std::size_t& begin) {
+    while(position == m_size) {
+      if(m_is_source_exhausted) {
+        return false;
+      }
+      auto shift = refill(begin);
+      position -= shift;
+      begin -= shift;
+    }
+    return true;
+  }
+
+  inline CsvReader::Field CsvReader::read_field() {
+    auto begin = m_position;
+    if(!is_available(m_position, begin)) {
+      m_is_exhausted = true;
+      return Field{{}, true, false};
+    }
+    if(m_buffer[m_position] == '"') {
+      return read_quoted_field();
+    }
+    auto i = m_position;
+    while(true) {
+      i = Details::find_csv_delimiter(m_buffer.data(), i, m_size);
+      if(i != m_size) {
+        m_position = i + 1;
+        return Field{{m_buffer.data() + begin, i - begin}, true, true};
+      }
+      if(!is_available(i, begin)) {
+        m_position = m_size;
+        m_is_exhausted = true;
+        return Field{{m_buffer.data() + begin, i - begin}, true, false};
+      }
+    }
+  }
+
+  inline CsvReader::Field CsvReader::read_quoted_field() {
+    auto begin = m_position + 1;
+    auto read = begin;
+    auto length = std::size_t(0);
+    auto make_field = [&](bool is_valid, bool is_terminated) {
+      return Field{{m_buffer.data() + begin, length}, is_valid,
+        is_terminated};
+    };
+    while(true) {
+      if(!is_available(read, begin)) {
+        m_position = m_size;
+        m_is_exhausted = true;
+        return make_field(true, false);
+      }
+      auto quote = static_cast<const char*>(std::memchr(
+        m_buffer.data() + read, '"', m_size - read));
+      auto end = quote ? static_cast<std::size_t>(quote - m_buffer.data()) :
+        m_size;
+      std::memmove(m_buffer.data() + begin + length, m_buffer.data() + read,
+        end - read);
+      length += end - read;
+      read = end;
+      if(!quote) {
+        continue;
+      }
+      ++read;
+      if(!is_available(read, begin)) {
+        m_position = m_size;
+        m_is_exhausted = true;
+        return make_field(true, false);
+      }
+      auto next = m_buffer[read];
+      ++read;
+      if(Details::is_csv_delimiter(next)) {
+        m_position = read;
+        return make_field(true, true);
+      } else if(next == '"') {
+        m_buffer[begin + length] = '"';
+        ++length;
+      } else {
+        while(true) {
+          read = Details::find_csv_delimiter(m_buffer.data(), read, m_size);
+          if(read != m_size) {
+            m_position = read + 1;
+            return make_field(false, true);
+          }
+          if(!is_available(read, begin)) {
+            m_position = m_size;
+            m_is_exhausted = true;
+            return make_field(false, false);
+          }
+        }
+      }
+    }
+  }
+}
+
+#endif
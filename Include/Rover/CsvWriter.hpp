@@ -0,0 +1,172 @@
+#ifndef ROVER_CSV_WRITER_HPP
+#define ROVER_CSV_WRITER_HPP
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "Rover/CsvReader.hpp"
+#include "Rover/Noncopyable.hpp"
+#include "Rover/Sample.hpp"
+
+namespace Rover {
+
+  //! Writes samples to a CSV through a large buffer.
+  /*!
+    \details Fields are quoted as by put_next_csv_field. Numbers are
+             formatted with std::to_chars, floating point numbers in the
+             shortest form that parses back to the same value, and strings
+             are copied while checking whether they need quoting. The buffer
+             is written to the sink whenever it is full, on flush and on
+             destruction.
+  */
+  class CsvWriter : private Noncopyable {
+    public:
+
+      //! Constructs a CsvWriter.
+      /*!
+        \param sink The output stream.
+        \param buffer_size The number of bytes written at once.
+      */
+      explicit CsvWriter(std::ostream& sink,
+        std::size_t buffer_size = CSV_BUFFER_SIZE);
+
+      //! Writes the buffered bytes.
+      ~CsvWriter();
+
+      //! Writes a sample followed by a line break.
+      /*!
+        \param sample The sample to write.
+      */
+      template<typename S>
+      void write(const S& sample);
+
+      //! Writes the buffered bytes to the sink.
+      void flush();
+
+    private:
+      std::ostream* m_sink;
+      std::vector<char> m_buffer;
+      std::size_t m_size;
+
+      char* reserve(std::size_t size);
+      void write_text(std::string_view text);
+      template<typename T>
+      void write_field(const T& value);
+  };
+
+namespace Details {
+  template<typename T>
+  struct is_tuple : std::false_type {};
+
+  template<typename... T>
+  struct is_tuple<std::tuple<T...>> : std::true_type {};
+
+  inline bool is_csv_special(char c) {
+    return c == ',' || c == '"' || c == '\n' || c == '\0';
+  }
+}
+
+  inline CsvWriter::CsvWriter(std::ostream& sink, std::size_t buffer_size)
+    : m_sink(&sink),
+      m_buffer(std::max(std::size_t(64), buffer_size)),
+      m_size(0) {}
+
+  inline CsvWriter::~CsvWriter() {
+    flush();
+  }
+
+  template<typename S>
+  void CsvWriter::write(const S& sample) {
+    if constexpr(Details::is_tuple<typename S::Arguments>::value) {
+      write_field(sample.m_result);
+      std::apply([&](const auto&... arguments) {
+        ((*reserve(1) = ',', ++m_size, write_field(arguments)), ...);
+      }, sample.m_arguments);
+    } else {
+      auto stream = std::ostringstream();
+      stream << sample;
+      write_text(stream.str());
+    }
+    *reserve(1) = '\n';
+    ++m_size;
+  }
+
+  inline void CsvWriter::flush() {
+    m_sink->write(m_buffer.data(), m_size);
+    m_size = 0;
+  }
+
+  inline char* CsvWriter::reserve(std::size_t size) {
+    if(m_buffer.size() - m_size < size) {
+      flush();
+      if(m_buffer.size() < size) {
+        m_buffer.resize(size);
+      }
+    }
+    return m_buffer.data() + m_size;
+  }
+
+  inline void CsvWriter::write_text(std::string_view text) {
+    std::memcpy(reserve(text.size()), text.data(), text.size());
+    m_size += text.size();
+  }
+
+  template<typename T>
+  void CsvWriter::write_field(const T& value) {
+    if constexpr(std::is_convertible_v<const T&, std::string_view>) {
+      auto text = std::string_view(value);
+      auto out = reserve(2 * text.size() + 2);
+      auto i = std::size_t(0);
+      while(i != text.size() && !Details::is_csv_special(text[i])) {
+        out[i] = text[i];
+        ++i;
+      }
+      if(i == text.size()) {
+        m_size += i;
+        return;
+      }
+      std::memmove(out + 1, out, i);
+      out[0] = '"';
+      auto size = i + 1;
+      for(; i != text.size(); ++i) {
+        if(text[i] == '"') {
+          out[size] = '"';
+          ++size;
+        }
+        out[size] = text[i];
+        ++size;
+      }
+      out[size] = '"';
+      m_size += size + 1;
+    } else if constexpr(Details::is_csv_character_v<T>) {
+      auto c = static_cast<char>(value);
+      if(Details::is_csv_special(c)) {
+        write_field(std::string_view(&c, 1));
+      } else {
+        *reserve(1) = c;
+        ++m_size;
+      }
+    } else if constexpr(std::is_same_v<T, bool>) {
+      *reserve(1) = value ? '1' : '0';
+      ++m_size;
+    } else if constexpr(std::is_arithmetic_v<T>) {
+      constexpr auto MAX_SIZE = std::size_t(64);
+      auto out = reserve(MAX_SIZE);
+      auto result = std::to_chars(out, out + MAX_SIZE, value);
+      m_size += static_cast<std::size_t>(result.ptr - out);
+    } else {
+      auto stream = std::ostringstream();
+      stream << value;
+      write_field(stream.str());
+    }
+  }
+}
+
+#endif
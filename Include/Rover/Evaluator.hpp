@@ -1,92 +1,631 @@
 #ifndef ROVER_EVALUATION_HPP
 #define ROVER_EVALUATION_HPP
 #include <algorithm>
-#include <memory>
-#include <typeindex>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#ifdef ROVER_ENABLE_PROFILING
+  #include <map>
+  #include <typeindex>
+#endif
+#include <memory_resource>
+#include <new>
 #include <typeinfo>
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include "Rover/Noncopyable.hpp"
 
 namespace Rover {
 
+  //! Type trait indicating whether a generator is the root of a tree, ie.
+  //! whether it holds its sub-generators by value and only evaluates
+  //! sub-generators that are themselves roots of trees.
+  /*!
+    \tparam G The type of the generator.
+    \details The nodes below the root of a tree can not be shared, so the
+             Evaluator memoizes the root alone and generates the rest of the
+             tree directly.
+  */
+  template<typename G, typename = void>
+  struct is_static_tree : std::false_type {};
+
+  template<typename G>
+  inline constexpr bool is_static_tree_v = is_static_tree<G>::value;
+
+  /** Stores the measurements an Evaluator made of a generator. */
+  struct GeneratorProfile {
+
+    //! The identity of the generator.
+    const void* m_identity;
+
+    //! The type of the generator.
+    const std::type_info* m_type;
+
+    //! The number of times the generator was evaluated.
+    std::size_t m_evaluations;
+
+    //! The number of evaluations answered with a memoized value.
+    std::size_t m_hits;
+
+    //! The number of evaluations that generated a value.
+    std::size_t m_misses;
+
+    //! The time spent generating values, including sub-generators.
+    std::chrono::nanoseconds m_total_time;
+
+    //! The time spent generating values, excluding sub-generators.
+    std::chrono::nanoseconds m_self_time;
+  };
+
+  //! The measurements of every generator an Evaluator evaluated.
+  using Profile = std::vector<GeneratorProfile>;
+
   /** Encapsulates the state needed to evaluate a generator. */
-  class Evaluator {
+  class Evaluator : private Noncopyable {
     public:
 
+      //! Constructs an Evaluator allocating from the default memory resource.
+      Evaluator();
+
+      //! Constructs an Evaluator allocating from a memory resource.
+      /*!
+        \param resource The memory resource used for all of the Evaluator's
+                        storage.
+      */
+      explicit Evaluator(std::pmr::memory_resource* resource);
+
+      Evaluator(Evaluator&& evaluator);
+
+      ~Evaluator();
+
       //! Returns the argument evaluated by a generator.
       /*!
         \param generator The generator to evaluate.
         \return The argument generated.
+        \details Evaluations are memoized in an open addressing table keyed
+                 by the identity of the generator, so a lookup takes
+                 constant time regardless of the size of the generator graph.
+                 Generators nested within a static tree bypass the table
+                 entirely. When dependency tracking is enabled the
+                 Evaluator also records which memoized generators each
+                 memoized generator evaluated.
       */
       template<typename Generator>
       typename Generator::Type evaluate(Generator& generator);
 
+      //! Discards the argument evaluated by a generator along with the
+      //! arguments of every generator that depends on it.
+      /*!
+        \param generator The generator to invalidate.
+        \details The discarded generators are evaluated again, lazily, the
+                 next time they are evaluated, while every other argument of
+                 the session is kept. Only the generator itself is discarded
+                 unless dependency tracking is enabled. Generators nested
+                 within a static tree are not memoized on their own, so
+                 invalidating one has no effect; invalidate the root of the
+                 tree instead, or hold the generator by pointer so that it is
+                 memoized separately.
+      */
+      template<typename Generator>
+      void invalidate(const Generator& generator);
+
+      //! Discards all evaluations, starting a new session.
+      /*!
+        \details The storage of the discarded evaluations is kept and reused
+                 by the next session, so evaluating the same generator graph
+                 repeatedly does no steady-state allocation.
+      */
+      void reset();
+
+      //! Returns whether the dependencies between generators are recorded.
+      bool is_tracking_dependencies() const;
+
+      //! Sets whether the dependencies between generators are recorded, which
+      //! invalidate needs to discard the generators depending on another.
+      /*!
+        \param is_tracking Whether to record dependencies.
+        \details Tracking is disabled by default since it slows down every
+                 memoized evaluation. Changing the setting starts a new
+                 session.
+      */
+      void set_dependency_tracking(bool is_tracking);
+
+      //! Returns the measurements of every generator evaluated since
+      //! construction or since the last call to reset_profile, ordered by
+      //! decreasing total time.
+      /*!
+        \details Measurements are only taken when ROVER_ENABLE_PROFILING is
+                 defined, otherwise the profile is empty and evaluating a
+                 generator does no additional work.
+      */
+      Profile profile() const;
+
+      //! Discards all measurements.
+      void reset_profile();
+
+      Evaluator& operator =(Evaluator&&) = delete;
+
     private:
-      struct BaseEvaluation {
-        virtual ~BaseEvaluation() = default;
-        virtual bool is_same(const std::type_index& type,
-          const void* address) = 0;
+      struct Entry {
+        const void* m_identity;
+        const std::type_info* m_type;
+        void* m_value;
+        std::size_t m_epoch;
+      };
+      struct Key {
+        const void* m_identity;
+        const std::type_info* m_type;
       };
-      template<typename T>
-      struct ValueEvaluation : BaseEvaluation {
-        using Type = T;
-        Type m_value;
+      struct Dependency {
+        Key m_generator;
+        Key m_dependent;
+      };
+      class ParentScope {
+        public:
+          ParentScope(Evaluator& evaluator, Key parent, bool is_reevaluation);
+
+          ~ParentScope();
 
-        template<typename U>
-        ValueEvaluation(U&& value);
+        private:
+          Evaluator* m_evaluator;
+          Key m_previous;
+          bool m_was_reevaluation;
+      };
+      struct Block {
+        std::byte* m_data;
+        std::size_t m_size;
+      };
+      struct Cleanup {
+        void* m_value;
+        void (*m_destroy)(void*);
       };
-      template<typename T, typename G>
-      struct Evaluation : ValueEvaluation<T> {
-        using Type = typename ValueEvaluation<T>::Type;
-        using Generator = G;
-        const Generator* m_generator;
-
-        template<typename U>
-        Evaluation(U&& value, const Generator& generator);
-        bool is_same(const std::type_index& type, const void* address) override;
+#ifdef ROVER_ENABLE_PROFILING
+      struct Frame {
+        std::size_t m_profile;
+        std::chrono::steady_clock::time_point m_start;
+        std::chrono::nanoseconds m_children_time;
       };
-      std::vector<std::unique_ptr<BaseEvaluation>> m_evaluations;
+      class ProfileScope {
+        public:
+          ProfileScope(Evaluator& evaluator, const void* identity,
+            const std::type_info& type);
+
+          ~ProfileScope();
+
+        private:
+          Evaluator* m_evaluator;
+      };
+#endif
+      static constexpr auto STALE = std::size_t(1);
+      static constexpr auto INITIAL_CAPACITY = std::size_t(16);
+      static constexpr auto INITIAL_BLOCK_SIZE = std::size_t(1024);
+      std::pmr::memory_resource* m_resource;
+      std::pmr::vector<Entry> m_entries;
+      std::pmr::vector<Block> m_blocks;
+      std::pmr::vector<Cleanup> m_cleanups;
+      std::pmr::vector<Dependency> m_dependencies;
+      std::pmr::vector<Key> m_invalidations;
+      std::size_t m_sorted_dependencies;
+      bool m_is_tracking;
+      Key m_parent;
+      bool m_is_reevaluation;
+      std::size_t m_size;
+      std::size_t m_epoch;
+      std::size_t m_block;
+      std::size_t m_offset;
+      bool m_is_static;
+#ifdef ROVER_ENABLE_PROFILING
+      Profile m_profile;
+      std::map<std::pair<const void*, std::type_index>, std::size_t>
+        m_profile_indices;
+      std::vector<Frame> m_frames;
+
+      GeneratorProfile& get_profile(const void* identity,
+        const std::type_info& type);
+#endif
+
+      template<typename Generator>
+      typename Generator::Type produce(Generator& generator);
+      void add_dependency(const void* identity, const std::type_info& type);
+      void invalidate(Key generator);
+      static std::size_t hash(const void* identity);
+      Entry* find(const void* identity, const std::type_info& type);
+      void insert(const void* identity, const std::type_info& type,
+        void* value);
+      void grow();
+      void* allocate(std::size_t size, std::size_t alignment);
   };
 
+  //! Returns the address identifying the effective generator.
+  /*!
+    \param generator The generator to identify.
+    \details Two generators evaluate to the same argument within an
+             Evaluator if and only if they have the same type and the same
+             identity. Overload this function for generators whose identity is
+             not their own address.
+  */
+  template<typename Generator>
+  const void* get_identity(const Generator& generator) {
+    return &generator;
+  }
+
   //! Tests if two instances represent the same effective generator.
   template<typename Generator>
   bool is_same(const Generator& left, const Generator& right) {
-    return &left == &right;
+    return get_identity(left) == get_identity(right);
   }
 
-  template<typename T>
-  template<typename U>
-  Evaluator::ValueEvaluation<T>::ValueEvaluation(U&& value)
-    : m_value(std::forward<U>(value)) {}
+  inline Evaluator::Evaluator()
+    : Evaluator(std::pmr::get_default_resource()) {}
+
+  inline Evaluator::Evaluator(std::pmr::memory_resource* resource)
+    : m_resource(resource),
+      m_entries(resource),
+      m_blocks(resource),
+      m_cleanups(resource),
+      m_dependencies(resource),
+      m_invalidations(resource),
+      m_sorted_dependencies(0),
+      m_is_tracking(false),
+      m_parent{nullptr, nullptr},
+      m_is_reevaluation(false),
+      m_size(0),
+      m_epoch(2),
+      m_block(0),
+      m_offset(0),
+      m_is_static(false) {}
 
-  template<typename T, typename G>
-  template<typename U>
-  Evaluator::Evaluation<T, G>::Evaluation(U&& value, const Generator& generator)
-      : ValueEvaluation<T>(std::forward<U>(value)),
-        m_generator(&generator) {}
+  inline Evaluator::Evaluator(Evaluator&& evaluator)
+      : m_resource(evaluator.m_resource),
+        m_entries(std::move(evaluator.m_entries)),
+        m_blocks(std::move(evaluator.m_blocks)),
+        m_cleanups(std::move(evaluator.m_cleanups)),
+        m_dependencies(std::move(evaluator.m_dependencies)),
+        m_invalidations(std::move(evaluator.m_invalidations)),
+        m_sorted_dependencies(evaluator.m_sorted_dependencies),
+        m_is_tracking(evaluator.m_is_tracking),
+        m_parent(evaluator.m_parent),
+        m_is_reevaluation(evaluator.m_is_reevaluation),
+        m_size(evaluator.m_size),
+        m_epoch(evaluator.m_epoch),
+        m_block(evaluator.m_block),
+        m_offset(evaluator.m_offset),
+        m_is_static(evaluator.m_is_static)
+#ifdef ROVER_ENABLE_PROFILING
+        , m_profile(std::move(evaluator.m_profile)),
+        m_profile_indices(std::move(evaluator.m_profile_indices)),
+        m_frames(std::move(evaluator.m_frames))
+#endif
+        {
+    evaluator.m_size = 0;
+    evaluator.m_sorted_dependencies = 0;
+    evaluator.m_block = 0;
+    evaluator.m_offset = 0;
+  }
 
-  template<typename T, typename G>
-  bool Evaluator::Evaluation<T, G>::is_same(const std::type_index& type,
-      const void* address) {
-    return type == typeid(Generator) && Rover::is_same(*m_generator,
-      *static_cast<const Generator*>(address));
+  inline Evaluator::~Evaluator() {
+    reset();
+    for(auto& block : m_blocks) {
+      m_resource->deallocate(block.m_data, block.m_size,
+        alignof(std::max_align_t));
+    }
   }
 
   template<typename Generator>
   typename Generator::Type Evaluator::evaluate(Generator& generator) {
     using Type = typename Generator::Type;
-    auto i = std::find_if(m_evaluations.begin(), m_evaluations.end(),
-      [&](const auto& evaluation) {
-        return evaluation->is_same(typeid(Generator), &generator);
+    if constexpr(is_static_tree_v<Generator>) {
+      if(m_is_static) {
+#ifdef ROVER_ENABLE_PROFILING
+        auto scope = ProfileScope(*this, get_identity(std::as_const(
+          generator)), typeid(Generator));
+#endif
+        return generator.generate(*this);
+      }
+    }
+    auto identity = get_identity(std::as_const(generator));
+    auto entry = find(identity, typeid(Generator));
+    if(entry && entry->m_epoch == m_epoch) {
+#ifdef ROVER_ENABLE_PROFILING
+      auto& profile = get_profile(identity, typeid(Generator));
+      ++profile.m_evaluations;
+      ++profile.m_hits;
+#endif
+      add_dependency(identity, typeid(Generator));
+      return *static_cast<Type*>(entry->m_value);
+    }
+#ifdef ROVER_ENABLE_PROFILING
+    auto profile_scope = ProfileScope(*this, identity, typeid(Generator));
+#endif
+    add_dependency(identity, typeid(Generator));
+    auto scope = ParentScope(*this, Key{identity, &typeid(Generator)},
+      entry != nullptr);
+    if(entry) {
+      auto value = static_cast<Type*>(entry->m_value);
+      auto update = produce(generator);
+      if constexpr(std::is_move_assignable_v<Type>) {
+        *value = std::move(update);
+      } else {
+        value->~Type();
+        new(value) Type(std::move(update));
+      }
+      find(identity, typeid(Generator))->m_epoch = m_epoch;
+      return *value;
+    }
+    auto value = new(allocate(sizeof(Type), alignof(Type))) Type(
+      produce(generator));
+    if constexpr(!std::is_trivially_destructible_v<Type>) {
+      m_cleanups.push_back(Cleanup{value, [](void* pointer) {
+        static_cast<Type*>(pointer)->~Type();
+      }});
+    }
+    insert(identity, typeid(Generator), value);
+    return *value;
+  }
+
+  template<typename Generator>
+  void Evaluator::invalidate(const Generator& generator) {
+    invalidate(Key{get_identity(generator), &typeid(Generator)});
+  }
+
+  inline void Evaluator::reset() {
+    for(auto i = m_cleanups.rbegin(); i != m_cleanups.rend(); ++i) {
+      i->m_destroy(i->m_value);
+    }
+    m_cleanups.clear();
+    m_dependencies.clear();
+    m_sorted_dependencies = 0;
+    m_size = 0;
+    m_epoch += 2 * STALE;
+    m_block = 0;
+    m_offset = 0;
+  }
+
+  inline bool Evaluator::is_tracking_dependencies() const {
+    return m_is_tracking;
+  }
+
+  inline void Evaluator::set_dependency_tracking(bool is_tracking) {
+    if(is_tracking != m_is_tracking) {
+      reset();
+      m_is_tracking = is_tracking;
+    }
+  }
+
+  inline Profile Evaluator::profile() const {
+#ifdef ROVER_ENABLE_PROFILING
+    auto profile = m_profile;
+    std::stable_sort(profile.begin(), profile.end(),
+      [](const auto& left, const auto& right) {
+        return left.m_total_time > right.m_total_time;
       });
-    if(i == m_evaluations.end()) {
-      auto evaluation = std::make_unique<Evaluation<Type, Generator>>(
-        generator.generate(*this), generator);
-      m_evaluations.push_back(std::move(evaluation));
-      i = m_evaluations.end() - 1;
+    return profile;
+#else
+    return {};
+#endif
+  }
+
+  inline void Evaluator::reset_profile() {
+#ifdef ROVER_ENABLE_PROFILING
+    m_profile.clear();
+    m_profile_indices.clear();
+    m_frames.clear();
+#endif
+  }
+
+#ifdef ROVER_ENABLE_PROFILING
+  inline Evaluator::ProfileScope::ProfileScope(Evaluator& evaluator,
+      const void* identity, const std::type_info& type)
+      : m_evaluator(&evaluator) {
+    auto& profile = evaluator.get_profile(identity, type);
+    ++profile.m_evaluations;
+    ++profile.m_misses;
+    evaluator.m_frames.push_back(Frame{static_cast<std::size_t>(
+      &profile - evaluator.m_profile.data()),
+      std::chrono::steady_clock::now(), std::chrono::nanoseconds(0)});
+  }
+
+  inline Evaluator::ProfileScope::~ProfileScope() {
+    auto& frames = m_evaluator->m_frames;
+    if(frames.empty()) {
+      return;
+    }
+    auto frame = frames.back();
+    frames.pop_back();
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - frame.m_start);
+    auto& profile = m_evaluator->m_profile[frame.m_profile];
+    profile.m_total_time += elapsed;
+    profile.m_self_time += elapsed - frame.m_children_time;
+    if(!frames.empty()) {
+      frames.back().m_children_time += elapsed;
+    }
+  }
+
+  inline GeneratorProfile& Evaluator::get_profile(const void* identity,
+      const std::type_info& type) {
+    auto index = m_profile_indices.try_emplace(std::pair(identity,
+      std::type_index(type)), m_profile.size());
+    if(index.second) {
+      m_profile.push_back(GeneratorProfile{identity, &type, 0, 0, 0,
+        std::chrono::nanoseconds(0), std::chrono::nanoseconds(0)});
+    }
+    return m_profile[index.first->second];
+  }
+#endif
+
+  inline Evaluator::ParentScope::ParentScope(Evaluator& evaluator,
+      Key parent, bool is_reevaluation)
+      : m_evaluator(&evaluator),
+        m_previous(evaluator.m_parent),
+        m_was_reevaluation(evaluator.m_is_reevaluation) {
+    if(evaluator.m_is_tracking) {
+      evaluator.m_parent = parent;
+      evaluator.m_is_reevaluation = is_reevaluation;
+    }
+  }
+
+  inline Evaluator::ParentScope::~ParentScope() {
+    if(m_evaluator->m_is_tracking) {
+      m_evaluator->m_parent = m_previous;
+      m_evaluator->m_is_reevaluation = m_was_reevaluation;
+    }
+  }
+
+  template<typename Generator>
+  typename Generator::Type Evaluator::produce(Generator& generator) {
+    if constexpr(is_static_tree_v<Generator>) {
+      struct StaticScope {
+        bool& m_is_static;
+
+        ~StaticScope() {
+          m_is_static = false;
+        }
+      };
+      m_is_static = true;
+      auto scope = StaticScope{m_is_static};
+      return generator.generate(*this);
+    } else {
+      return generator.generate(*this);
+    }
+  }
+
+  inline void Evaluator::add_dependency(const void* identity,
+      const std::type_info& type) {
+    if(!m_is_tracking || !m_parent.m_identity) {
+      return;
+    }
+    if(m_is_reevaluation) {
+      auto end = m_dependencies.begin() + m_sorted_dependencies;
+      for(auto i = std::lower_bound(m_dependencies.begin(), end, identity,
+          [](const auto& dependency, auto identity) {
+            return dependency.m_generator.m_identity < identity;
+          }); i != end && i->m_generator.m_identity == identity; ++i) {
+        if(*i->m_generator.m_type == type &&
+            i->m_dependent.m_identity == m_parent.m_identity &&
+            *i->m_dependent.m_type == *m_parent.m_type) {
+          return;
+        }
+      }
+    }
+    m_dependencies.push_back(Dependency{Key{identity, &type}, m_parent});
+  }
+
+  inline void Evaluator::invalidate(Key generator) {
+    auto entry = find(generator.m_identity, *generator.m_type);
+    if(!entry || entry->m_epoch != m_epoch) {
+      return;
+    }
+    entry->m_epoch = m_epoch + STALE;
+    if(m_sorted_dependencies != m_dependencies.size()) {
+      std::sort(m_dependencies.begin(), m_dependencies.end(),
+        [](const auto& left, const auto& right) {
+          return left.m_generator.m_identity < right.m_generator.m_identity;
+        });
+      m_sorted_dependencies = m_dependencies.size();
+    }
+    m_invalidations.push_back(generator);
+    while(!m_invalidations.empty()) {
+      auto next = m_invalidations.back();
+      m_invalidations.pop_back();
+      for(auto i = std::lower_bound(m_dependencies.begin(),
+          m_dependencies.end(), next.m_identity,
+          [](const auto& dependency, auto identity) {
+            return dependency.m_generator.m_identity < identity;
+          }); i != m_dependencies.end() &&
+          i->m_generator.m_identity == next.m_identity; ++i) {
+        if(*i->m_generator.m_type != *next.m_type) {
+          continue;
+        }
+        auto dependent = find(i->m_dependent.m_identity,
+          *i->m_dependent.m_type);
+        if(dependent && dependent->m_epoch == m_epoch) {
+          dependent->m_epoch = m_epoch + STALE;
+          m_invalidations.push_back(i->m_dependent);
+        }
+      }
+    }
+  }
+
+  inline std::size_t Evaluator::hash(const void* identity) {
+    auto key = static_cast<std::uint64_t>(
+      reinterpret_cast<std::uintptr_t>(identity));
+    key *= 0x9E3779B97F4A7C15ULL;
+    return static_cast<std::size_t>(key ^ (key >> 32));
+  }
+
+  inline Evaluator::Entry* Evaluator::find(const void* identity,
+      const std::type_info& type) {
+    if(m_entries.empty()) {
+      return nullptr;
+    }
+    auto mask = m_entries.size() - 1;
+    for(auto i = hash(identity) & mask;; i = (i + 1) & mask) {
+      auto& entry = m_entries[i];
+      if((entry.m_epoch & ~STALE) != m_epoch) {
+        return nullptr;
+      } else if(entry.m_identity == identity && *entry.m_type == type) {
+        return &entry;
+      }
+    }
+  }
+
+  inline void Evaluator::insert(const void* identity,
+      const std::type_info& type, void* value) {
+    if(2 * (m_size + 1) > m_entries.size()) {
+      grow();
+    }
+    auto mask = m_entries.size() - 1;
+    auto i = hash(identity) & mask;
+    while((m_entries[i].m_epoch & ~STALE) == m_epoch) {
+      i = (i + 1) & mask;
+    }
+    m_entries[i] = Entry{identity, &type, value, m_epoch};
+    ++m_size;
+  }
+
+  inline void Evaluator::grow() {
+    auto entries = std::pmr::vector<Entry>(std::max(INITIAL_CAPACITY,
+      2 * m_entries.size()), Entry{nullptr, nullptr, nullptr, 0}, m_resource);
+    std::swap(entries, m_entries);
+    auto mask = m_entries.size() - 1;
+    for(auto& entry : entries) {
+      if((entry.m_epoch & ~STALE) == m_epoch) {
+        auto i = hash(entry.m_identity) & mask;
+        while((m_entries[i].m_epoch & ~STALE) == m_epoch) {
+          i = (i + 1) & mask;
+        }
+        m_entries[i] = entry;
+      }
+    }
+  }
+
+  inline void* Evaluator::allocate(std::size_t size, std::size_t alignment) {
+    while(true) {
+      if(m_block < m_blocks.size()) {
+        auto& block = m_blocks[m_block];
+        auto base = reinterpret_cast<std::uintptr_t>(block.m_data);
+        auto offset = static_cast<std::size_t>(((base + m_offset +
+          alignment - 1) & ~(alignment - 1)) - base);
+        if(offset + size <= block.m_size) {
+          m_offset = offset + size;
+          return block.m_data + offset;
+        }
+        if(m_block + 1 < m_blocks.size()) {
+          ++m_block;
+          m_offset = 0;
+          continue;
+        }
+      }
+      auto block_size = std::max(size + alignment, m_blocks.empty() ?
+        INITIAL_BLOCK_SIZE : 2 * m_blocks.back().m_size);
+      auto data = static_cast<std::byte*>(m_resource->allocate(block_size,
+        alignof(std::max_align_t)));
+      m_blocks.push_back(Block{data, block_size});
+      m_block = m_blocks.size() - 1;
+      m_offset = 0;
     }
-    return static_cast<ValueEvaluation<Type>&>(**i).m_value;
   }
 }
 
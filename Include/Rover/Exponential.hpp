@@ -0,0 +1,128 @@
+#ifndef ROVER_EXPONENTIAL_HPP
+#define ROVER_EXPONENTIAL_HPP
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "Rover/Autobox.hpp"
+#include "Rover/Batch.hpp"
+#include "Rover/Evaluator.hpp"
+#include "Rover/Random.hpp"
+#include "Rover/Sampling.hpp"
+
+namespace Rover {
+
+  //! Generates an argument from an exponential distribution whose rate is
+  //! determined by a sub-generator.
+  /*!
+    \tparam L The type of generator evaluating to the rate, the inverse of
+              the mean.
+    \tparam R The type of random engine.
+  */
+  template<typename L, typename R = DefaultEngine>
+  class Exponential {
+    public:
+
+      //! The type of generator evaluating to the rate.
+      using Rate = autobox_t<L>;
+
+      //! The type of random engine.
+      using Engine = R;
+
+      using Type = std::common_type_t<typename Rate::Type, double>;
+
+      //! Constructs an Exponential.
+      /*!
+        \param rate The generator evaluating to the rate, which must be
+                    positive.
+        \details The engine is seeded with next_seed.
+      */
+      template<typename RateFwd>
+      explicit Exponential(RateFwd&& rate);
+
+      Type generate(Evaluator& evaluator);
+
+      //! Produces independent values in bulk.
+      /*!
+        \param count The number of values to produce.
+        \param out The output iterator receiving the values.
+        \return The output iterator past the last value written.
+      */
+      template<typename OutputIterator>
+      OutputIterator generate_batch(std::size_t count, OutputIterator out);
+
+      //! Maps a fraction to the value of the distribution at that quantile,
+      //! used by quasi-random generators.
+      /*!
+        \param evaluator The evaluator keeping track of the current session.
+        \param fraction A number in [0, 1).
+      */
+      Type transform(Evaluator& evaluator, double fraction);
+
+      //! Returns the random engine.
+      Engine& get_engine();
+
+    private:
+      Rate m_rate;
+      Engine m_engine;
+  };
+
+  template<typename RateFwd>
+  Exponential(RateFwd&&) -> Exponential<std::decay_t<RateFwd>>;
+
+  template<typename L, typename R>
+  struct is_batchable<Exponential<L, R>> : std::bool_constant<
+    is_batchable_v<typename Exponential<L, R>::Rate>> {};
+
+  template<typename L, typename R>
+  struct is_static_tree<Exponential<L, R>> : std::bool_constant<
+    is_static_tree_v<typename Exponential<L, R>::Rate>> {};
+
+  template<typename L, typename R>
+  template<typename RateFwd>
+  Exponential<L, R>::Exponential(RateFwd&& rate)
+    : m_rate(std::forward<RateFwd>(rate)),
+      m_engine(next_seed()) {}
+
+  template<typename L, typename R>
+  typename Exponential<L, R>::Type Exponential<L, R>::generate(
+      Evaluator& evaluator) {
+    return transform(evaluator, Details::draw_unit(m_engine));
+  }
+
+  template<typename L, typename R>
+  template<typename OutputIterator>
+  OutputIterator Exponential<L, R>::generate_batch(std::size_t count,
+      OutputIterator out) {
+    auto rate = Details::BatchColumn<Rate>();
+    auto lanes = Details::Lanes();
+    for(auto i = std::size_t(0); i < count; i += BATCH_BLOCK_SIZE) {
+      auto size = std::min(BATCH_BLOCK_SIZE, count - i);
+      rate.fill(m_rate, size);
+      for(auto j = std::size_t(0); j < size; j += SAMPLING_LANES) {
+        Details::draw_exponential(m_engine, lanes);
+        auto width = std::min(SAMPLING_LANES, size - j);
+        for(auto k = std::size_t(0); k != width; ++k) {
+          *out = static_cast<Type>(lanes[k] / rate[j + k]);
+          ++out;
+        }
+      }
+    }
+    return out;
+  }
+
+  template<typename L, typename R>
+  typename Exponential<L, R>::Type Exponential<L, R>::transform(
+      Evaluator& evaluator, double fraction) {
+    return static_cast<Type>(-std::log1p(-fraction) /
+      evaluator.evaluate(m_rate));
+  }
+
+  template<typename L, typename R>
+  typename Exponential<L, R>::Engine& Exponential<L, R>::get_engine() {
+    return m_engine;
+  }
+}
+
+#endif
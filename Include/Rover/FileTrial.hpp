@@ -0,0 +1,479 @@
+#ifndef ROVER_FILE_TRIAL_HPP
+#define ROVER_FILE_TRIAL_HPP
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "Rover/BinaryCodec.hpp"
+#include "Rover/ObjectiveCache.hpp"
+#include "Rover/Random.hpp"
+#include "Rover/TrialIterator.hpp"
+
+namespace Rover {
+
+  //! The default number of samples in a chunk of a FileTrial.
+  inline constexpr auto FILE_TRIAL_CHUNK_SIZE = std::size_t(4096);
+
+  //! The default number of chunks cached in memory by a FileTrial.
+  inline constexpr auto FILE_TRIAL_CACHE_CAPACITY = std::size_t(16);
+
+namespace Details {
+
+  /** Precedes the samples of a chunk. */
+  struct ChunkHeader {
+    std::uint64_t m_count;
+    std::uint64_t m_checksum;
+  };
+
+  /** Locates a chunk in the footer index. */
+  struct ChunkIndexEntry {
+    std::uint64_t m_offset;
+    std::uint64_t m_count;
+  };
+
+  /** Ends the footer index, at the very end of the file. */
+  struct ChunkFooter {
+    std::uint64_t m_chunk_count;
+    std::uint64_t m_checksum;
+    char m_magic[8];
+  };
+
+  inline std::uint64_t compute_checksum(const void* data, std::size_t size,
+      std::uint64_t seed = 0) {
+    constexpr auto PRIME = std::uint64_t(0x9E3779B185EBCA87ULL);
+    constexpr auto LANES = std::size_t(4);
+    auto round = [](std::uint64_t lane, std::uint64_t word) {
+      lane += word * 0xC2B2AE3D27D4EB4FULL;
+      return ((lane << 31) | (lane >> 33)) * PRIME;
+    };
+    auto bytes = static_cast<const unsigned char*>(data);
+    auto lanes = std::array<std::uint64_t, LANES>{seed, seed + 1, seed + 2,
+      seed + 3};
+    auto i = std::size_t(0);
+    for(; i + sizeof(lanes) <= size; i += sizeof(lanes)) {
+      auto words = std::array<std::uint64_t, LANES>();
+      std::memcpy(words.data(), bytes + i, sizeof(words));
+      for(auto j = std::size_t(0); j != LANES; ++j) {
+        lanes[j] = round(lanes[j], words[j]);
+      }
+    }
+    auto checksum = mix_seed(seed ^ size);
+    for(auto lane : lanes) {
+      checksum = mix_seed(checksum ^ lane);
+    }
+    for(; i < size; i += sizeof(std::uint64_t)) {
+      auto word = std::uint64_t(0);
+      std::memcpy(&word, bytes + i, std::min(sizeof(word), size - i));
+      checksum = mix_seed(checksum ^ word);
+    }
+    return checksum;
+  }
+}
+
+  //! Stores samples in an append-only file of fixed-size chunks.
+  /*!
+    \tparam S The type of the samples, which must satisfy
+              is_binary_sample_v.
+    \details Inserted samples are buffered until a chunk is full, then the
+             chunk is appended with a checksum. The footer index of every
+             chunk is only written on flush and on closing, so appending
+             costs no more than the chunks themselves. A crash therefore
+             loses at most the buffered chunk: on opening, a file whose
+             footer is missing or damaged is recovered by scanning the chunks
+             and keeping those with a valid checksum. Random access loads
+             whole chunks through a bounded LRU cache, verifying their
+             checksum. Samples are returned by copy. Concurrent reads are
+             synchronized, but inserting requires exclusive access.
+  */
+  template<typename S>
+  class FileTrial {
+    public:
+
+      //! The type of stored samples.
+      using Sample = S;
+
+      //! The type of the constant iterator.
+      using Iterator = TrialIterator<FileTrial>;
+
+      //! Opens a FileTrial, creating the file if it does not exist.
+      /*!
+        \param path The path to the file.
+        \param chunk_size The number of samples per chunk of a new file. An
+                          existing file keeps its own chunk size.
+        \param cache_capacity The largest number of chunks kept in memory.
+        \throw std::runtime_error If the file can not be opened or holds
+                                  samples of another type.
+      */
+      explicit FileTrial(const std::string& path,
+        std::size_t chunk_size = FILE_TRIAL_CHUNK_SIZE,
+        std::size_t cache_capacity = FILE_TRIAL_CACHE_CAPACITY);
+
+      //! Writes the buffered samples and closes the file.
+      ~FileTrial();
+
+      //! Inserts a sample to this trial.
+      void insert(const Sample& s);
+
+      //! Inserts all samples from a collection via iterators to this one.
+      template<typename Begin, typename End>
+      void insert(Begin b, End e);
+
+      //! Writes the buffered samples as a chunk, even if it is not full,
+      //! followed by the footer index.
+      void flush();
+
+      //! Returns a constant iterator to the first sample
+      Iterator begin() const;
+
+      //! Returns a constant iterator to the past-the-end sample
+      Iterator end() const;
+
+      //! Number of samples in this trial.
+      std::size_t size() const;
+
+      //! Returns the number of samples per chunk.
+      std::size_t chunk_size() const;
+
+      //! Returns the statistics of the chunk cache.
+      CacheStatistics get_cache_statistics() const;
+
+      //! Returns a copy of a sample.
+      /*!
+        \param index The index of the sample.
+        \throw std::runtime_error If the chunk of the sample is damaged.
+      */
+      Sample operator [](std::size_t index) const;
+
+    private:
+      using Chunk = std::shared_ptr<const std::vector<Sample>>;
+      using Cache = ObjectiveCache<std::tuple<std::size_t>, Chunk>;
+      std::string m_path;
+      mutable std::fstream m_file;
+      std::size_t m_chunk_size;
+      std::vector<Details::ChunkIndexEntry> m_index;
+      std::vector<std::size_t> m_ends;
+      std::uint64_t m_data_end;
+      bool m_has_footer;
+      std::vector<Sample> m_pending;
+      mutable std::mutex m_mutex;
+      mutable Cache m_cache;
+      mutable std::size_t m_last_index;
+      mutable Chunk m_last_chunk;
+
+      void create(std::size_t chunk_size);
+      void open();
+      bool read_footer(std::uint64_t file_size);
+      void recover(std::uint64_t file_size);
+      void write_chunk();
+      void erase_footer();
+      void write_footer();
+      Chunk load(std::size_t index) const;
+  };
+
+  template<typename S>
+  FileTrial<S>::FileTrial(const std::string& path, std::size_t chunk_size,
+      std::size_t cache_capacity)
+      : m_path(path),
+        m_chunk_size(std::max(std::size_t(1), chunk_size)),
+        m_data_end(BINARY_DATA_OFFSET),
+        m_has_footer(false),
+        m_cache(cache_capacity),
+        m_last_index(0) {
+    static_assert(is_binary_sample_v<Sample>,
+      "FileTrial requires trivially copyable fields.");
+    if(!std::filesystem::exists(m_path)) {
+      create(m_chunk_size);
+    }
+    open();
+    m_pending.reserve(m_chunk_size);
+  }
+
+  template<typename S>
+  FileTrial<S>::~FileTrial() {
+    try {
+      flush();
+    } catch(const std::exception&) {}
+  }
+
+  template<typename S>
+  void FileTrial<S>::insert(const Sample& s) {
+    m_pending.push_back(s);
+    if(m_pending.size() == m_chunk_size) {
+      write_chunk();
+    }
+  }
+
+  template<typename S>
+  template<typename Begin, typename End>
+  void FileTrial<S>::insert(Begin b, End e) {
+    for(; b != e; ++b) {
+      insert(*b);
+    }
+  }
+
+  template<typename S>
+  void FileTrial<S>::flush() {
+    if(!m_pending.empty()) {
+      write_chunk();
+    }
+    if(!m_has_footer) {
+      write_footer();
+    }
+  }
+
+  template<typename S>
+  typename FileTrial<S>::Iterator FileTrial<S>::begin() const {
+    return Iterator(*this, 0);
+  }
+
+  template<typename S>
+  typename FileTrial<S>::Iterator FileTrial<S>::end() const {
+    return Iterator(*this, size());
+  }
+
+  template<typename S>
+  std::size_t FileTrial<S>::size() const {
+    if(m_ends.empty()) {
+      return m_pending.size();
+    }
+    return m_ends.back() + m_pending.size();
+  }
+
+  template<typename S>
+  std::size_t FileTrial<S>::chunk_size() const {
+    return m_chunk_size;
+  }
+
+  template<typename S>
+  CacheStatistics FileTrial<S>::get_cache_statistics() const {
+    return m_cache.get_statistics();
+  }
+
+  template<typename S>
+  typename FileTrial<S>::Sample FileTrial<S>::operator [](
+      std::size_t index) const {
+    auto stored = m_ends.empty() ? std::size_t(0) : m_ends.back();
+    if(index >= stored) {
+      return m_pending[index - stored];
+    }
+    auto chunk = static_cast<std::size_t>(std::upper_bound(m_ends.begin(),
+      m_ends.end(), index) - m_ends.begin());
+    auto offset = chunk == 0 ? index : index - m_ends[chunk - 1];
+    auto lock = std::lock_guard(m_mutex);
+    if(!m_last_chunk || m_last_index != chunk) {
+      m_last_chunk = m_cache.get(std::tuple(chunk), [&](std::size_t chunk) {
+        return load(chunk);
+      });
+      m_last_index = chunk;
+    }
+    return (*m_last_chunk)[offset];
+  }
+
+  template<typename S>
+  void FileTrial<S>::create(std::size_t chunk_size) {
+    auto header = BinaryHeader::make<Sample>(chunk_size);
+    std::memcpy(header.m_magic, "ROVERCHK", sizeof(header.m_magic));
+    auto padding = std::vector<char>(BINARY_DATA_OFFSET - sizeof(header));
+    auto file = std::ofstream(m_path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(padding.data(), padding.size());
+    file.close();
+    if(!file) {
+      throw std::runtime_error("Unable to create " + m_path + ".");
+    }
+    m_file.open(m_path, std::ios::binary | std::ios::in | std::ios::out);
+    write_footer();
+    m_file.close();
+  }
+
+  template<typename S>
+  void FileTrial<S>::open() {
+    m_file.open(m_path, std::ios::binary | std::ios::in | std::ios::out);
+    if(!m_file) {
+      throw std::runtime_error("Unable to open " + m_path + ".");
+    }
+    auto header = BinaryHeader();
+    if(!m_file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.m_magic, "ROVERCHK", sizeof(header.m_magic)) !=
+        0) {
+      throw std::runtime_error("Not a chunked trial.");
+    }
+    std::memcpy(header.m_magic, "ROVERBIN", sizeof(header.m_magic));
+    m_chunk_size = static_cast<std::size_t>(header.m_count);
+    header.m_count = 0;
+    header.validate<Sample>(BINARY_DATA_OFFSET);
+    auto file_size = static_cast<std::uint64_t>(
+      std::filesystem::file_size(m_path));
+    if(!read_footer(file_size)) {
+      recover(file_size);
+    }
+  }
+
+  template<typename S>
+  bool FileTrial<S>::read_footer(std::uint64_t file_size) {
+    auto footer = Details::ChunkFooter();
+    if(file_size < BINARY_DATA_OFFSET + sizeof(footer)) {
+      return false;
+    }
+    m_file.clear();
+    m_file.seekg(file_size - sizeof(footer));
+    if(!m_file.read(reinterpret_cast<char*>(&footer), sizeof(footer)) ||
+        std::memcmp(footer.m_magic, "ROVEREND", sizeof(footer.m_magic)) !=
+        0) {
+      return false;
+    }
+    auto index_size = footer.m_chunk_count * sizeof(Details::ChunkIndexEntry);
+    if(footer.m_chunk_count > file_size / sizeof(Details::ChunkIndexEntry) ||
+        file_size - sizeof(footer) - BINARY_DATA_OFFSET < index_size) {
+      return false;
+    }
+    auto index = std::vector<Details::ChunkIndexEntry>(
+      static_cast<std::size_t>(footer.m_chunk_count));
+    m_file.seekg(file_size - sizeof(footer) - index_size);
+    if(!m_file.read(reinterpret_cast<char*>(index.data()), index_size) ||
+        Details::compute_checksum(index.data(), index_size) !=
+        footer.m_checksum) {
+      return false;
+    }
+    auto ends = std::vector<std::size_t>();
+    auto data_end = std::uint64_t(BINARY_DATA_OFFSET);
+    for(auto& entry : index) {
+      if(entry.m_offset != data_end) {
+        return false;
+      }
+      data_end += sizeof(Details::ChunkHeader) + entry.m_count *
+        sizeof(Sample);
+      ends.push_back((ends.empty() ? 0 : ends.back()) +
+        static_cast<std::size_t>(entry.m_count));
+    }
+    if(data_end != file_size - sizeof(footer) - index_size) {
+      return false;
+    }
+    m_index = std::move(index);
+    m_ends = std::move(ends);
+    m_data_end = data_end;
+    m_has_footer = true;
+    return true;
+  }
+
+  template<typename S>
+  void FileTrial<S>::recover(std::uint64_t file_size) {
+    m_index.clear();
+    m_ends.clear();
+    m_data_end = BINARY_DATA_OFFSET;
+    auto samples = std::vector<Sample>();
+    while(true) {
+      auto header = Details::ChunkHeader();
+      m_file.clear();
+      m_file.seekg(m_data_end);
+      if(!m_file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+          header.m_count == 0 || header.m_count > m_chunk_size ||
+          (file_size - m_data_end - sizeof(header)) / sizeof(Sample) <
+          header.m_count) {
+        break;
+      }
+      samples.resize(static_cast<std::size_t>(header.m_count));
+      auto bytes = samples.size() * sizeof(Sample);
+      if(!m_file.read(reinterpret_cast<char*>(samples.data()), bytes) ||
+          Details::compute_checksum(samples.data(), bytes) !=
+          header.m_checksum) {
+        break;
+      }
+      m_index.push_back({m_data_end, header.m_count});
+      m_ends.push_back((m_ends.empty() ? 0 : m_ends.back()) + samples.size());
+      m_data_end += sizeof(header) + bytes;
+    }
+    m_file.close();
+    std::filesystem::resize_file(m_path, m_data_end);
+    m_file.open(m_path, std::ios::binary | std::ios::in | std::ios::out);
+    write_footer();
+  }
+
+  template<typename S>
+  void FileTrial<S>::write_chunk() {
+    erase_footer();
+    auto bytes = m_pending.size() * sizeof(Sample);
+    auto header = Details::ChunkHeader{m_pending.size(),
+      Details::compute_checksum(m_pending.data(), bytes)};
+    m_file.clear();
+    m_file.seekp(m_data_end);
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_file.write(reinterpret_cast<const char*>(m_pending.data()), bytes);
+    m_file.flush();
+    if(!m_file) {
+      throw std::runtime_error("Unable to write to " + m_path + ".");
+    }
+    m_index.push_back({m_data_end, m_pending.size()});
+    m_ends.push_back(size());
+    m_data_end += sizeof(header) + bytes;
+    m_pending.clear();
+  }
+
+  template<typename S>
+  void FileTrial<S>::erase_footer() {
+    if(!m_has_footer) {
+      return;
+    }
+    auto magic = std::array<char, sizeof(Details::ChunkFooter::m_magic)>();
+    m_file.clear();
+    m_file.seekp(m_data_end + m_index.size() *
+      sizeof(Details::ChunkIndexEntry) + offsetof(Details::ChunkFooter,
+      m_magic));
+    m_file.write(magic.data(), magic.size());
+    m_file.flush();
+    if(!m_file) {
+      throw std::runtime_error("Unable to write to " + m_path + ".");
+    }
+    m_has_footer = false;
+  }
+
+  template<typename S>
+  void FileTrial<S>::write_footer() {
+    auto index_size = m_index.size() * sizeof(Details::ChunkIndexEntry);
+    auto footer = Details::ChunkFooter();
+    footer.m_chunk_count = m_index.size();
+    footer.m_checksum = Details::compute_checksum(m_index.data(), index_size);
+    std::memcpy(footer.m_magic, "ROVEREND", sizeof(footer.m_magic));
+    m_file.clear();
+    m_file.seekp(m_data_end);
+    m_file.write(reinterpret_cast<const char*>(m_index.data()), index_size);
+    m_file.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+    m_file.flush();
+    if(!m_file) {
+      throw std::runtime_error("Unable to write to " + m_path + ".");
+    }
+    m_has_footer = true;
+  }
+
+  template<typename S>
+  typename FileTrial<S>::Chunk FileTrial<S>::load(std::size_t index) const {
+    auto& entry = m_index[index];
+    auto header = Details::ChunkHeader();
+    auto samples = std::make_shared<std::vector<Sample>>(
+      static_cast<std::size_t>(entry.m_count));
+    auto bytes = samples->size() * sizeof(Sample);
+    m_file.clear();
+    m_file.seekg(entry.m_offset);
+    if(!m_file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        !m_file.read(reinterpret_cast<char*>(samples->data()), bytes)) {
+      throw std::runtime_error("Unable to read from " + m_path + ".");
+    }
+    if(header.m_count != entry.m_count || header.m_checksum !=
+        Details::compute_checksum(samples->data(), bytes)) {
+      throw std::runtime_error("Damaged chunk in " + m_path + ".");
+    }
+    return samples;
+  }
+}
+
+#endif
@@ -1,7 +1,15 @@
 #ifndef ROVER_FILTER_HPP
 #define ROVER_FILTER_HPP
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
 #include <type_traits>
+#include <vector>
 #include "Rover/Autobox.hpp"
+#include "Rover/Batch.hpp"
 #include "Rover/Evaluator.hpp"
 #include "Rover/Generator.hpp"
 
@@ -13,7 +21,12 @@ namespace Rover {
     \tparam P The type of the predicate function.
     \tparam G The type of the generator.
     \details Only supports isolated generators, i.e. generators with no
-             non-deterministic dependencies.
+             non-deterministic dependencies. Candidates are produced in
+             batches whose size adapts to the observed acceptance rate, and
+             the candidates not yet tested are kept for the next evaluations.
+             Generators that are not batchable are evaluated within a single
+             session of the Filter's own Evaluator, reset between candidates.
+             Copies of a Filter start without buffered candidates.
   */
   template<typename P, typename G>
   class Filter {
@@ -37,30 +50,185 @@ namespace Rover {
       template<typename PredicateFwd, typename GeneratorFwd>
       Filter(PredicateFwd&& predicate, GeneratorFwd&& generator);
 
+      //! Constructs a Filter using a predicate function, a generator and a
+      //! limit on the number of candidates tested by an evaluation.
+      /*!
+        \param predicate The predicate function. The filter considered passed
+                         when the function returns true.
+        \param generator The isolated generator.
+        \param max_attempts The maximum number of candidates tested by an
+                            evaluation.
+      */
+      template<typename PredicateFwd, typename GeneratorFwd>
+      Filter(PredicateFwd&& predicate, GeneratorFwd&& generator,
+        std::size_t max_attempts);
+
+      Filter(const Filter& filter);
+
+      Filter(Filter&& filter) = default;
+
       //! Evaluates the filter.
+      /*!
+        \throw std::runtime_error If max_attempts candidates in a row fail
+               the predicate.
+      */
       Type generate(Evaluator& evaluator);
 
+      //! Produces independent values in bulk.
+      /*!
+        \param count The number of values to produce.
+        \param out The output iterator receiving the values.
+        \return The output iterator past the last value written.
+      */
+      template<typename OutputIterator>
+      OutputIterator generate_batch(std::size_t count, OutputIterator out);
+
+      //! Returns the maximum number of candidates tested by an evaluation.
+      std::size_t get_max_attempts() const;
+
+      //! Sets the maximum number of candidates tested by an evaluation.
+      void set_max_attempts(std::size_t max_attempts);
+
+      //! Returns the number of candidates tested.
+      std::size_t attempts() const;
+
+      //! Returns the number of candidates that passed the predicate.
+      std::size_t acceptances() const;
+
+      //! Returns the fraction of the candidates tested that passed the
+      //! predicate, or 1 if no candidate was tested.
+      double acceptance_rate() const;
+
     private:
       Predicate m_predicate;
       Generator m_generator;
+      std::size_t m_max_attempts;
+      std::size_t m_attempts;
+      std::size_t m_acceptances;
+      std::vector<Type> m_candidates;
+      std::size_t m_next_candidate;
+      Evaluator m_evaluator;
+
+      Type next();
+      void refill(std::size_t remaining_attempts);
   };
 
   template<typename PredicateFwd, typename GeneratorFwd>
   Filter(PredicateFwd&&, GeneratorFwd&&) -> Filter<std::decay_t<PredicateFwd>,
     std::decay_t<GeneratorFwd>>;
 
+  template<typename PredicateFwd, typename GeneratorFwd>
+  Filter(PredicateFwd&&, GeneratorFwd&&, std::size_t) -> Filter<
+    std::decay_t<PredicateFwd>, std::decay_t<GeneratorFwd>>;
+
+  template<typename P, typename G>
+  struct is_batchable<Filter<P, G>> : std::true_type {};
+
+  template<typename P, typename G>
+  struct is_static_tree<Filter<P, G>> : std::true_type {};
+
   template<typename P, typename G>
   template<typename PredicateFwd, typename GeneratorFwd>
   Filter<P, G>::Filter(PredicateFwd&& predicate, GeneratorFwd&& generator)
+    : Filter(std::forward<PredicateFwd>(predicate),
+        std::forward<GeneratorFwd>(generator),
+        std::numeric_limits<std::size_t>::max()) {}
+
+  template<typename P, typename G>
+  template<typename PredicateFwd, typename GeneratorFwd>
+  Filter<P, G>::Filter(PredicateFwd&& predicate, GeneratorFwd&& generator,
+    std::size_t max_attempts)
     : m_predicate(std::forward<PredicateFwd>(predicate)),
-      m_generator(std::forward<GeneratorFwd>(generator)) {}
+      m_generator(std::forward<GeneratorFwd>(generator)),
+      m_max_attempts(max_attempts),
+      m_attempts(0),
+      m_acceptances(0),
+      m_next_candidate(0) {}
+
+  template<typename P, typename G>
+  Filter<P, G>::Filter(const Filter& filter)
+    : m_predicate(filter.m_predicate),
+      m_generator(filter.m_generator),
+      m_max_attempts(filter.m_max_attempts),
+      m_attempts(filter.m_attempts),
+      m_acceptances(filter.m_acceptances),
+      m_next_candidate(0) {}
+
+  template<typename P, typename G>
+  typename Filter<P, G>::Type Filter<P, G>::generate(Evaluator&) {
+    return next();
+  }
+
+  template<typename P, typename G>
+  template<typename OutputIterator>
+  OutputIterator Filter<P, G>::generate_batch(std::size_t count,
+      OutputIterator out) {
+    for(auto i = std::size_t(0); i < count; ++i) {
+      *out = next();
+      ++out;
+    }
+    return out;
+  }
+
+  template<typename P, typename G>
+  std::size_t Filter<P, G>::get_max_attempts() const {
+    return m_max_attempts;
+  }
+
+  template<typename P, typename G>
+  void Filter<P, G>::set_max_attempts(std::size_t max_attempts) {
+    m_max_attempts = max_attempts;
+  }
+
+  template<typename P, typename G>
+  std::size_t Filter<P, G>::attempts() const {
+    return m_attempts;
+  }
+
+  template<typename P, typename G>
+  std::size_t Filter<P, G>::acceptances() const {
+    return m_acceptances;
+  }
+
+  template<typename P, typename G>
+  double Filter<P, G>::acceptance_rate() const {
+    if(m_attempts == 0) {
+      return 1.;
+    }
+    return static_cast<double>(m_acceptances) / m_attempts;
+  }
+
+  template<typename P, typename G>
+  typename Filter<P, G>::Type Filter<P, G>::next() {
+    for(auto i = std::size_t(0); i < m_max_attempts; ++i) {
+      if(m_next_candidate == m_candidates.size()) {
+        refill(m_max_attempts - i);
+      }
+      auto& candidate = m_candidates[m_next_candidate];
+      ++m_next_candidate;
+      ++m_attempts;
+      if(m_predicate(std::as_const(candidate))) {
+        ++m_acceptances;
+        return std::move(candidate);
+      }
+    }
+    throw std::runtime_error("Filter exceeded its maximum attempts.");
+  }
 
   template<typename P, typename G>
-  typename Filter<P, G>::Type Filter<P, G>::generate(Evaluator& evaluator) {
-    while(true) {
-      auto value = Rover::generate(m_generator);
-      if(m_predicate(value)) {
-        return value;
+  void Filter<P, G>::refill(std::size_t remaining_attempts) {
+    auto rate = (m_acceptances + 1.) / (m_attempts + 2.);
+    auto size = static_cast<std::size_t>(std::min(std::ceil(1. / rate),
+      static_cast<double>(BATCH_BLOCK_SIZE)));
+    size = std::max(std::size_t(1), std::min(size, remaining_attempts));
+    m_candidates.clear();
+    m_next_candidate = 0;
+    if constexpr(is_batchable_v<Generator>) {
+      m_generator.generate_batch(size, std::back_inserter(m_candidates));
+    } else {
+      for(auto i = std::size_t(0); i < size; ++i) {
+        m_evaluator.reset();
+        m_candidates.push_back(m_evaluator.evaluate(m_generator));
       }
     }
   }
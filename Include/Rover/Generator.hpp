@@ -31,6 +31,19 @@ namespace Rover {
     return evaluator.evaluate(generator);
   }
 
+  //! Produces an argument from a generator in a new session of an existing
+  //! Evaluator.
+  /*
+    \param generator The generator to evaluate.
+    \param evaluator The Evaluator to reset and reuse.
+    \return The argument produced by the <i>generator</i>.
+  */
+  template<typename Generator>
+  auto generate(Generator& generator, Evaluator& evaluator) {
+    evaluator.reset();
+    return evaluator.evaluate(generator);
+  }
+
   template<typename T, typename = void>
   struct is_generator : std::false_type {};
 
@@ -0,0 +1,197 @@
+#ifndef ROVER_GRID_HPP
+#define ROVER_GRID_HPP
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Rover/Evaluator.hpp"
+
+namespace Rover {
+
+  //! Enumerates the cartesian product of several finite generators in a
+  //! defined order.
+  /*!
+    \tparam G The types of the generators, granular or integral Ranges and
+              Selects, or any generator providing
+              std::uint64_t size(Evaluator&) or std::uint64_t size() const,
+              and Type at(Evaluator&, std::uint64_t index).
+    \details The points are ordered lexicographically with the last generator
+             varying fastest, and the k-th point is decoded from k as a
+             mixed-radix number, so the grid is never materialized. A Grid
+             can be split into contiguous shards that enumerate disjoint
+             parts of the product. Once its last point is generated, a Grid
+             starts over from its first point.
+  */
+  template<typename... G>
+  class Grid {
+    public:
+
+      //! The type of the generated tuples.
+      using Type = std::tuple<typename G::Type...>;
+
+      //! Constructs a Grid over the whole cartesian product.
+      /*!
+        \param generators The generators, one per dimension.
+        \throw std::invalid_argument If a generator has no values.
+        \throw std::overflow_error If the number of points does not fit in 64
+               bits.
+        \details The number of values of every generator is computed once,
+                 so the generators must define fixed sets of values.
+      */
+      template<typename... GeneratorsFwd>
+      explicit Grid(GeneratorsFwd&&... generators);
+
+      Type generate(Evaluator& evaluator);
+
+      //! Returns the number of points in the Grid.
+      std::uint64_t size() const;
+
+      //! Returns a point of the Grid.
+      /*!
+        \param evaluator The evaluator keeping track of the current session.
+        \param index The index of the point, less than size.
+      */
+      Type at(Evaluator& evaluator, std::uint64_t index);
+
+      //! Returns the index of the next point generated.
+      std::uint64_t get_index() const;
+
+      //! Jumps to a point of the Grid.
+      /*!
+        \param index The index of the next point generated. Indexes past the
+                     last point wrap around as the Grid starts over.
+      */
+      void seek(std::uint64_t index);
+
+      //! Returns a contiguous part of the Grid.
+      /*!
+        \param index The index of the shard, less than count.
+        \param count The number of shards the Grid is split into.
+        \return A Grid enumerating the index-th of count contiguous parts of
+                this Grid, whose sizes differ by at most one.
+      */
+      Grid shard(std::uint64_t index, std::uint64_t count) const;
+
+    private:
+      static constexpr auto DIMENSIONS = sizeof...(G);
+      std::tuple<G...> m_generators;
+      std::array<std::uint64_t, DIMENSIONS> m_radices;
+      std::uint64_t m_begin;
+      std::uint64_t m_end;
+      std::uint64_t m_index;
+
+      template<std::size_t... I>
+      Type at(Evaluator& evaluator, std::uint64_t index,
+        std::index_sequence<I...>);
+  };
+
+  template<typename... GeneratorsFwd>
+  Grid(GeneratorsFwd&&...) -> Grid<std::decay_t<GeneratorsFwd>...>;
+
+  template<typename... G>
+  struct is_static_tree<Grid<G...>> : std::bool_constant<
+    (is_static_tree_v<G> && ...)> {};
+
+namespace Details {
+  template<typename T, typename = void>
+  struct has_evaluated_size : std::false_type {};
+
+  template<typename T>
+  struct has_evaluated_size<T, std::void_t<decltype(std::declval<T&>().size(
+    std::declval<Evaluator&>()))>> : std::true_type {};
+
+  template<typename Generator>
+  std::uint64_t get_size(Generator& generator, Evaluator& evaluator) {
+    if constexpr(has_evaluated_size<Generator>::value) {
+      return generator.size(evaluator);
+    } else {
+      return generator.size();
+    }
+  }
+}
+
+  template<typename... G>
+  template<typename... GeneratorsFwd>
+  Grid<G...>::Grid(GeneratorsFwd&&... generators)
+      : m_generators(std::forward<GeneratorsFwd>(generators)...),
+        m_begin(0),
+        m_end(1),
+        m_index(0) {
+    auto evaluator = Evaluator();
+    m_radices = std::apply([&](auto&... generators) {
+      return std::array<std::uint64_t, DIMENSIONS>{
+        Details::get_size(generators, evaluator)...};
+    }, m_generators);
+    for(auto radix : m_radices) {
+      if(radix == 0) {
+        throw std::invalid_argument("Grid dimension has no values.");
+      }
+      if(m_end > std::numeric_limits<std::uint64_t>::max() / radix) {
+        throw std::overflow_error("Grid has more than 2^64 points.");
+      }
+      m_end *= radix;
+    }
+  }
+
+  template<typename... G>
+  typename Grid<G...>::Type Grid<G...>::generate(Evaluator& evaluator) {
+    if(m_index == m_end - m_begin) {
+      m_index = 0;
+    }
+    auto value = at(evaluator, m_index);
+    ++m_index;
+    return value;
+  }
+
+  template<typename... G>
+  std::uint64_t Grid<G...>::size() const {
+    return m_end - m_begin;
+  }
+
+  template<typename... G>
+  typename Grid<G...>::Type Grid<G...>::at(Evaluator& evaluator,
+      std::uint64_t index) {
+    return at(evaluator, m_begin + index, std::index_sequence_for<G...>());
+  }
+
+  template<typename... G>
+  std::uint64_t Grid<G...>::get_index() const {
+    return m_index;
+  }
+
+  template<typename... G>
+  void Grid<G...>::seek(std::uint64_t index) {
+    m_index = index % size();
+  }
+
+  template<typename... G>
+  Grid<G...> Grid<G...>::shard(std::uint64_t index,
+      std::uint64_t count) const {
+    auto size = m_end - m_begin;
+    auto quotient = size / count;
+    auto remainder = size % count;
+    auto shard = *this;
+    shard.m_begin = m_begin + index * quotient + std::min(index, remainder);
+    shard.m_end = shard.m_begin + quotient + (index < remainder ? 1 : 0);
+    shard.m_index = 0;
+    return shard;
+  }
+
+  template<typename... G>
+  template<std::size_t... I>
+  typename Grid<G...>::Type Grid<G...>::at(Evaluator& evaluator,
+      std::uint64_t index, std::index_sequence<I...>) {
+    auto digits = std::array<std::uint64_t, DIMENSIONS>();
+    for(auto i = DIMENSIONS; i-- != 0;) {
+      digits[i] = index % m_radices[i];
+      index /= m_radices[i];
+    }
+    return Type(std::get<I>(m_generators).at(evaluator, digits[I])...);
+  }
+}
+
+#endif
@@ -0,0 +1,313 @@
+#ifndef ROVER_GUIDED_HPP
+#define ROVER_GUIDED_HPP
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Rover/Batch.hpp"
+#include "Rover/Evaluator.hpp"
+
+namespace Rover {
+namespace Details {
+  template<typename Arguments, std::size_t... I>
+  double squared_distance(const Arguments& left, const Arguments& right,
+      std::index_sequence<I...>) {
+    auto square = [](double value) {
+      return value * value;
+    };
+    return (0. + ... + square(static_cast<double>(std::get<I>(left)) -
+      static_cast<double>(std::get<I>(right))));
+  }
+
+  template<typename Arguments>
+  double squared_distance(const Arguments& left, const Arguments& right) {
+    return squared_distance(left, right, std::make_index_sequence<
+      std::tuple_size_v<Arguments>>());
+  }
+
+  template<typename Trial, typename Arguments>
+  std::size_t find_nearest(const Trial& trial, const Arguments& arguments) {
+    auto nearest = std::size_t(0);
+    auto distance = std::numeric_limits<double>::infinity();
+    for(auto i = std::size_t(0); i < trial.size(); ++i) {
+      auto candidate = squared_distance(arguments, trial[i].m_arguments);
+      if(candidate < distance) {
+        nearest = i;
+        distance = candidate;
+      }
+    }
+    return nearest;
+  }
+}
+
+  //! Acquisition function favoring the arguments with the highest predicted
+  //! result.
+  /*!
+    \tparam M The type of the model, a function object predicting a result
+              from a tuple of arguments.
+  */
+  template<typename M>
+  class Prediction {
+    public:
+
+      //! The type of the model.
+      using Model = M;
+
+      //! Constructs a Prediction.
+      /*!
+        \param model The model, which must outlive the Prediction and can be
+                     refitted in place as samples are collected.
+      */
+      explicit Prediction(const Model& model);
+
+      //! Returns the predicted result of the arguments.
+      template<typename Arguments>
+      double operator ()(const Arguments& arguments) const;
+
+    private:
+      const Model* m_model;
+  };
+
+  //! Acquisition function favoring the arguments farthest from the samples
+  //! already collected.
+  /*!
+    \tparam T The type of the trial.
+    \details The score is the Euclidean distance between the arguments and
+             the nearest sample of the trial, so the dimensions should have
+             comparable scales.
+  */
+  template<typename T>
+  class Novelty {
+    public:
+
+      //! The type of the trial.
+      using Trial = T;
+
+      //! Constructs a Novelty.
+      /*!
+        \param trial The trial, which must outlive the Novelty and can keep
+                     growing as samples are collected.
+      */
+      explicit Novelty(const Trial& trial);
+
+      //! Returns the distance from the arguments to the nearest sample, or
+      //! infinity if the trial is empty.
+      template<typename Arguments>
+      double operator ()(const Arguments& arguments) const;
+
+    private:
+      const Trial* m_trial;
+  };
+
+  //! Acquisition function favoring the arguments close to the samples the
+  //! model fits worst.
+  /*!
+    \tparam M The type of the model, a function object predicting a result
+              from a tuple of arguments.
+    \tparam T The type of the trial.
+  */
+  template<typename M, typename T>
+  class Residual {
+    public:
+
+      //! The type of the model.
+      using Model = M;
+
+      //! The type of the trial.
+      using Trial = T;
+
+      //! Constructs a Residual.
+      /*!
+        \param model The model, which must outlive the Residual.
+        \param trial The trial, which must outlive the Residual.
+      */
+      Residual(const Model& model, const Trial& trial);
+
+      //! Returns the absolute residual of the model at the sample nearest to
+      //! the arguments, or infinity if the trial is empty.
+      template<typename Arguments>
+      double operator ()(const Arguments& arguments) const;
+
+    private:
+      const Model* m_model;
+      const Trial* m_trial;
+  };
+
+  template<typename M, typename T>
+  Residual(const M&, const T&) -> Residual<M, T>;
+
+  //! Generates tuples of values from several Ranges, biased towards the
+  //! tuples an acquisition function scores highest.
+  /*!
+    \tparam A The type of the acquisition function, taking a tuple of
+              values and returning a score as a double.
+    \tparam G The types of the generators, one per dimension.
+    \details Each evaluation draws a number of candidate tuples from the
+             generators and returns the one with the highest score. A single
+             candidate reduces to independent sampling, and more candidates
+             concentrate the samples around the best scored regions. The
+             candidates are drawn in batches, each in a session of its own
+             rather than the caller's Evaluator, so generators shared with
+             the rest of an expression are not held to the same value. Only
+             supports isolated generators, i.e. generators with no
+             non-deterministic dependencies.
+  */
+  template<typename A, typename... G>
+  class Guided {
+    public:
+
+      //! The type of the acquisition function.
+      using Acquisition = A;
+
+      //! The type of the generated tuples.
+      using Type = std::tuple<typename G::Type...>;
+
+      //! Constructs a Guided generator.
+      /*!
+        \param acquisition The acquisition function.
+        \param candidates The number of candidates drawn by an evaluation,
+                          at least one.
+        \param generators The generators, one per dimension.
+      */
+      template<typename AcquisitionFwd, typename... GeneratorsFwd>
+      Guided(AcquisitionFwd&& acquisition, std::size_t candidates,
+        GeneratorsFwd&&... generators);
+
+      Type generate(Evaluator& evaluator);
+
+      //! Returns the number of candidates drawn by an evaluation.
+      std::size_t get_candidates() const;
+
+      //! Sets the number of candidates drawn by an evaluation.
+      void set_candidates(std::size_t candidates);
+
+      //! Returns the acquisition function.
+      Acquisition& get_acquisition();
+
+      //! Returns the acquisition function.
+      const Acquisition& get_acquisition() const;
+
+    private:
+      using Generators = std::tuple<G...>;
+      using Columns = std::tuple<std::vector<typename G::Type>...>;
+      Acquisition m_acquisition;
+      std::size_t m_candidates;
+      Generators m_generators;
+      Columns m_columns;
+
+      template<std::size_t... I>
+      Type generate(std::index_sequence<I...>);
+  };
+
+  template<typename AcquisitionFwd, typename... GeneratorsFwd>
+  Guided(AcquisitionFwd&&, std::size_t, GeneratorsFwd&&...) -> Guided<
+    std::decay_t<AcquisitionFwd>, std::decay_t<GeneratorsFwd>...>;
+
+  template<typename A, typename... G>
+  struct is_static_tree<Guided<A, G...>> : std::bool_constant<
+    (is_static_tree_v<G> && ...)> {};
+
+  template<typename M>
+  Prediction<M>::Prediction(const Model& model)
+    : m_model(&model) {}
+
+  template<typename M>
+  template<typename Arguments>
+  double Prediction<M>::operator ()(const Arguments& arguments) const {
+    return static_cast<double>((*m_model)(arguments));
+  }
+
+  template<typename T>
+  Novelty<T>::Novelty(const Trial& trial)
+    : m_trial(&trial) {}
+
+  template<typename T>
+  template<typename Arguments>
+  double Novelty<T>::operator ()(const Arguments& arguments) const {
+    if(m_trial->size() == 0) {
+      return std::numeric_limits<double>::infinity();
+    }
+    auto nearest = Details::find_nearest(*m_trial, arguments);
+    return std::sqrt(Details::squared_distance(arguments,
+      (*m_trial)[nearest].m_arguments));
+  }
+
+  template<typename M, typename T>
+  Residual<M, T>::Residual(const Model& model, const Trial& trial)
+    : m_model(&model),
+      m_trial(&trial) {}
+
+  template<typename M, typename T>
+  template<typename Arguments>
+  double Residual<M, T>::operator ()(const Arguments& arguments) const {
+    if(m_trial->size() == 0) {
+      return std::numeric_limits<double>::infinity();
+    }
+    auto& sample = (*m_trial)[Details::find_nearest(*m_trial, arguments)];
+    return std::abs(static_cast<double>(sample.m_result) -
+      static_cast<double>((*m_model)(sample.m_arguments)));
+  }
+
+  template<typename A, typename... G>
+  template<typename AcquisitionFwd, typename... GeneratorsFwd>
+  Guided<A, G...>::Guided(AcquisitionFwd&& acquisition,
+    std::size_t candidates, GeneratorsFwd&&... generators)
+    : m_acquisition(std::forward<AcquisitionFwd>(acquisition)),
+      m_candidates(std::max(std::size_t(1), candidates)),
+      m_generators(std::forward<GeneratorsFwd>(generators)...) {}
+
+  template<typename A, typename... G>
+  typename Guided<A, G...>::Type Guided<A, G...>::generate(
+      Evaluator&) {
+    return generate(std::index_sequence_for<G...>());
+  }
+
+  template<typename A, typename... G>
+  std::size_t Guided<A, G...>::get_candidates() const {
+    return m_candidates;
+  }
+
+  template<typename A, typename... G>
+  void Guided<A, G...>::set_candidates(std::size_t candidates) {
+    m_candidates = std::max(std::size_t(1), candidates);
+  }
+
+  template<typename A, typename... G>
+  typename Guided<A, G...>::Acquisition& Guided<A, G...>::get_acquisition() {
+    return m_acquisition;
+  }
+
+  template<typename A, typename... G>
+  const typename Guided<A, G...>::Acquisition&
+      Guided<A, G...>::get_acquisition() const {
+    return m_acquisition;
+  }
+
+  template<typename A, typename... G>
+  template<std::size_t... I>
+  typename Guided<A, G...>::Type Guided<A, G...>::generate(
+      std::index_sequence<I...>) {
+    ((std::get<I>(m_columns).clear(), Rover::generate_batch(
+      std::get<I>(m_generators), m_candidates, std::back_inserter(
+      std::get<I>(m_columns)))), ...);
+    auto best = std::size_t(0);
+    auto best_score = -std::numeric_limits<double>::infinity();
+    for(auto i = std::size_t(0); i < m_candidates; ++i) {
+      auto candidate = Type(std::get<I>(m_columns)[i]...);
+      auto score = static_cast<double>(m_acquisition(std::as_const(
+        candidate)));
+      if(score > best_score || i == 0) {
+        best = i;
+        best_score = score;
+      }
+    }
+    return Type(std::move(std::get<I>(m_columns)[best])...);
+  }
+}
+
+#endif
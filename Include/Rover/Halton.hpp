@@ -0,0 +1,171 @@
+#ifndef ROVER_HALTON_HPP
+#define ROVER_HALTON_HPP
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Rover/Evaluator.hpp"
+#include "Rover/Random.hpp"
+
+namespace Rover {
+namespace Details {
+  inline std::vector<std::uint32_t> get_primes(std::size_t count) {
+    auto primes = std::vector<std::uint32_t>();
+    for(auto candidate = std::uint32_t(2); primes.size() < count;
+        ++candidate) {
+      if(std::none_of(primes.begin(), primes.end(), [&](auto prime) {
+          return candidate % prime == 0;
+        })) {
+        primes.push_back(candidate);
+      }
+    }
+    return primes;
+  }
+}
+
+  //! Generates tuples of values from several Ranges following a Halton
+  //! low-discrepancy sequence, so that the tuples cover the space spanned by
+  //! the Ranges more evenly than independent draws.
+  /*!
+    \tparam G The types of the Ranges, or of any generator providing
+              Type transform(Evaluator&, double fraction).
+    \details The k-th tuple maps the radical inverse of k in the d-th prime
+             base to the d-th Range, which respects the Range's interval and
+             granularity. The sequence can optionally be scrambled by
+             applying random permutations to the digits of every radical
+             inverse.
+  */
+  template<typename... G>
+  class Halton {
+    public:
+
+      //! The type of the generated tuples.
+      using Type = std::tuple<typename G::Type...>;
+
+      //! Constructs a Halton sequence over Ranges, starting at index 0.
+      /*!
+        \param generators The Ranges, one per dimension.
+      */
+      template<typename... GeneratorsFwd>
+      explicit Halton(GeneratorsFwd&&... generators);
+
+      Type generate(Evaluator& evaluator);
+
+      //! Returns the index of the next tuple generated.
+      std::uint64_t get_index() const;
+
+      //! Jumps to an index of the sequence, which can be used to split the
+      //! sequence among workers without overlap.
+      /*!
+        \param index The index of the next tuple generated.
+      */
+      void seek(std::uint64_t index);
+
+      //! Scrambles the sequence with random digit permutations.
+      /*!
+        \param seed The seed of the permutations, equal seeds producing equal
+                    sequences.
+      */
+      void scramble(std::uint64_t seed);
+
+    private:
+      using Generators = std::tuple<G...>;
+      static constexpr auto DIMENSIONS = sizeof...(G);
+      Generators m_generators;
+      std::array<std::uint32_t, DIMENSIONS> m_bases;
+      std::array<std::vector<std::vector<std::uint32_t>>, DIMENSIONS>
+        m_permutations;
+      std::uint64_t m_index;
+
+      double get_radical_inverse(std::size_t dimension, std::uint64_t index)
+        const;
+      template<std::size_t... I>
+      Type generate(Evaluator& evaluator, std::index_sequence<I...>);
+  };
+
+  template<typename... GeneratorsFwd>
+  Halton(GeneratorsFwd&&...) -> Halton<std::decay_t<GeneratorsFwd>...>;
+
+  template<typename... G>
+  struct is_static_tree<Halton<G...>> : std::bool_constant<
+    (is_static_tree_v<G> && ...)> {};
+
+  template<typename... G>
+  template<typename... GeneratorsFwd>
+  Halton<G...>::Halton(GeneratorsFwd&&... generators)
+      : m_generators(std::forward<GeneratorsFwd>(generators)...),
+        m_index(0) {
+    auto primes = Details::get_primes(DIMENSIONS);
+    std::copy(primes.begin(), primes.end(), m_bases.begin());
+  }
+
+  template<typename... G>
+  typename Halton<G...>::Type Halton<G...>::generate(Evaluator& evaluator) {
+    auto value = generate(evaluator, std::index_sequence_for<G...>());
+    ++m_index;
+    return value;
+  }
+
+  template<typename... G>
+  std::uint64_t Halton<G...>::get_index() const {
+    return m_index;
+  }
+
+  template<typename... G>
+  void Halton<G...>::seek(std::uint64_t index) {
+    m_index = index;
+  }
+
+  template<typename... G>
+  void Halton<G...>::scramble(std::uint64_t seed) {
+    for(auto i = std::size_t(0); i < DIMENSIONS; ++i) {
+      auto base = m_bases[i];
+      auto digits = static_cast<std::size_t>(std::ceil(64 / std::log2(base)));
+      auto engine = DefaultEngine(seed, i);
+      m_permutations[i].resize(digits);
+      for(auto& permutation : m_permutations[i]) {
+        permutation.resize(base);
+        std::iota(permutation.begin(), permutation.end(), std::uint32_t(0));
+        std::shuffle(permutation.begin(), permutation.end(), engine);
+      }
+    }
+  }
+
+  template<typename... G>
+  double Halton<G...>::get_radical_inverse(std::size_t dimension,
+      std::uint64_t index) const {
+    auto base = m_bases[dimension];
+    auto& permutations = m_permutations[dimension];
+    auto inverse = 0.;
+    auto factor = 1. / base;
+    if(permutations.empty()) {
+      while(index != 0) {
+        inverse += (index % base) * factor;
+        index /= base;
+        factor /= base;
+      }
+    } else {
+      for(auto& permutation : permutations) {
+        inverse += permutation[index % base] * factor;
+        index /= base;
+        factor /= base;
+      }
+    }
+    return std::min(inverse, std::nextafter(1., 0.));
+  }
+
+  template<typename... G>
+  template<std::size_t... I>
+  typename Halton<G...>::Type Halton<G...>::generate(Evaluator& evaluator,
+      std::index_sequence<I...>) {
+    return Type(std::get<I>(m_generators).transform(evaluator,
+      get_radical_inverse(I, m_index))...);
+  }
+}
+
+#endif
@@ -0,0 +1,223 @@
+#ifndef ROVER_LATIN_HYPERCUBE_HPP
+#define ROVER_LATIN_HYPERCUBE_HPP
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Rover/Evaluator.hpp"
+#include "Rover/Random.hpp"
+
+namespace Rover {
+namespace Details {
+
+  /** Computes a pseudo-random permutation of [0, size) one element at a time
+      using a Feistel network with cycle walking, without storing it. */
+  class FeistelPermutation {
+    public:
+
+      //! Constructs the identity permutation of a single element.
+      FeistelPermutation();
+
+      //! Constructs a FeistelPermutation.
+      /*!
+        \param size The number of elements permuted.
+        \param seed The seed selecting the permutation.
+      */
+      FeistelPermutation(std::uint64_t size, std::uint64_t seed);
+
+      //! Returns the image of an index in [0, size).
+      std::uint64_t operator ()(std::uint64_t index) const;
+
+    private:
+      static constexpr auto ROUNDS = 4;
+      std::uint64_t m_size;
+      std::uint64_t m_seed;
+      int m_half_bits;
+      std::uint64_t m_mask;
+
+      std::uint64_t encrypt(std::uint64_t value) const;
+  };
+
+  inline FeistelPermutation::FeistelPermutation()
+    : FeistelPermutation(1, 0) {}
+
+  inline FeistelPermutation::FeistelPermutation(std::uint64_t size,
+      std::uint64_t seed)
+      : m_size(size),
+        m_seed(seed),
+        m_half_bits(1) {
+    while(m_half_bits < 32 && (std::uint64_t(1) << (2 * m_half_bits)) <
+        size) {
+      ++m_half_bits;
+    }
+    m_mask = (std::uint64_t(1) << m_half_bits) - 1;
+  }
+
+  inline std::uint64_t FeistelPermutation::operator ()(
+      std::uint64_t index) const {
+    do {
+      index = encrypt(index);
+    } while(index >= m_size);
+    return index;
+  }
+
+  inline std::uint64_t FeistelPermutation::encrypt(
+      std::uint64_t value) const {
+    auto left = (value >> m_half_bits) & m_mask;
+    auto right = value & m_mask;
+    for(auto round = std::uint64_t(0); round < ROUNDS; ++round) {
+      auto next = left ^ (mix_seed(m_seed ^ (round << 56) ^ right) & m_mask);
+      left = right;
+      right = next;
+    }
+    return (left << m_half_bits) | right;
+  }
+}
+
+  //! Generates tuples of values from several Ranges following a Latin
+  //! hypercube design, so that each plan of a given number of samples
+  //! covers every Range evenly.
+  /*!
+    \tparam G The types of the Ranges, or of any generator providing
+              Type transform(Evaluator&, double fraction).
+    \details Each Range is split into as many strata of equal probability
+             as there are samples in a plan, and every stratum of every Range
+             is visited exactly once per plan at a random offset. The order
+             in which a Range's strata are visited is a pseudo-random
+             permutation computed on demand, so a plan takes constant memory
+             regardless of its size. Once a plan is exhausted a new plan
+             starts with fresh permutations.
+  */
+  template<typename... G>
+  class LatinHypercube {
+    public:
+
+      //! The type of the generated tuples.
+      using Type = std::tuple<typename G::Type...>;
+
+      //! Constructs a LatinHypercube.
+      /*!
+        \param count The number of samples in a plan.
+        \param generators The Ranges, one per dimension.
+        \throw std::invalid_argument If count is zero.
+        \details The permutations and offsets are seeded with next_seed.
+      */
+      template<typename... GeneratorsFwd>
+      explicit LatinHypercube(std::uint64_t count,
+        GeneratorsFwd&&... generators);
+
+      Type generate(Evaluator& evaluator);
+
+      //! Returns the number of samples in a plan.
+      std::uint64_t get_count() const;
+
+      //! Returns the index of the next sample within the current plan.
+      std::uint64_t get_index() const;
+
+      //! Jumps to a sample, counting from the first sample of the first
+      //! plan.
+      /*!
+        \param index The index of the next sample generated. Indexes past the
+                     end of a plan select the following plans.
+      */
+      void seek(std::uint64_t index);
+
+    private:
+      using Generators = std::tuple<G...>;
+      static constexpr auto DIMENSIONS = sizeof...(G);
+      Generators m_generators;
+      std::uint64_t m_count;
+      std::uint64_t m_seed;
+      std::uint64_t m_plan;
+      std::uint64_t m_index;
+      std::array<Details::FeistelPermutation, DIMENSIONS> m_permutations;
+      DefaultEngine m_engine;
+
+      void start_plan();
+      template<std::size_t... I>
+      Type generate(Evaluator& evaluator, std::index_sequence<I...>);
+  };
+
+  template<typename... GeneratorsFwd>
+  LatinHypercube(std::uint64_t, GeneratorsFwd&&...) ->
+    LatinHypercube<std::decay_t<GeneratorsFwd>...>;
+
+  template<typename... G>
+  struct is_static_tree<LatinHypercube<G...>> : std::bool_constant<
+    (is_static_tree_v<G> && ...)> {};
+
+  template<typename... G>
+  template<typename... GeneratorsFwd>
+  LatinHypercube<G...>::LatinHypercube(std::uint64_t count,
+      GeneratorsFwd&&... generators)
+      : m_generators(std::forward<GeneratorsFwd>(generators)...),
+        m_count(count),
+        m_seed(next_seed()),
+        m_plan(0),
+        m_index(0),
+        m_engine(next_seed()) {
+    if(m_count == 0) {
+      throw std::invalid_argument("LatinHypercube plan has no samples.");
+    }
+    start_plan();
+  }
+
+  template<typename... G>
+  typename LatinHypercube<G...>::Type LatinHypercube<G...>::generate(
+      Evaluator& evaluator) {
+    if(m_index == m_count) {
+      ++m_plan;
+      m_index = 0;
+      start_plan();
+    }
+    auto value = generate(evaluator, std::index_sequence_for<G...>());
+    ++m_index;
+    return value;
+  }
+
+  template<typename... G>
+  std::uint64_t LatinHypercube<G...>::get_count() const {
+    return m_count;
+  }
+
+  template<typename... G>
+  std::uint64_t LatinHypercube<G...>::get_index() const {
+    return m_index;
+  }
+
+  template<typename... G>
+  void LatinHypercube<G...>::seek(std::uint64_t index) {
+    auto plan = index / m_count;
+    m_index = index % m_count;
+    if(plan != m_plan) {
+      m_plan = plan;
+      start_plan();
+    }
+  }
+
+  template<typename... G>
+  void LatinHypercube<G...>::start_plan() {
+    for(auto i = std::size_t(0); i < DIMENSIONS; ++i) {
+      m_permutations[i] = Details::FeistelPermutation(m_count, derive_seed(
+        m_seed, m_plan * DIMENSIONS + i));
+    }
+  }
+
+  template<typename... G>
+  template<std::size_t... I>
+  typename LatinHypercube<G...>::Type LatinHypercube<G...>::generate(
+      Evaluator& evaluator, std::index_sequence<I...>) {
+    auto fractions = std::array<double, DIMENSIONS>{std::min(
+      (m_permutations[I](m_index) + std::generate_canonical<double, 32>(
+      m_engine)) / m_count, std::nextafter(1., 0.))...};
+    return Type(std::get<I>(m_generators).transform(evaluator,
+      fractions[I])...);
+  }
+}
+
+#endif
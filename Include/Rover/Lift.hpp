@@ -1,8 +1,11 @@
 #ifndef ROVER_LIFT_HPP
 #define ROVER_LIFT_HPP
+#include <algorithm>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include "Rover/Autobox.hpp"
+#include "Rover/Batch.hpp"
 #include "Rover/Evaluator.hpp"
 #include "Rover/Pointer.hpp"
 
@@ -32,9 +35,26 @@ namespace Rover {
 
     constexpr Type generate(Evaluator& evaluator);
 
+    //! Produces independent values in bulk by applying the callable to
+    //! blocks of values produced by the sub-generators.
+    /*!
+      \param count The number of values to produce.
+      \param out The output iterator receiving the values.
+      \return The output iterator past the last value written.
+    */
+    template<typename OutputIterator>
+    OutputIterator generate_batch(std::size_t count, OutputIterator out);
+
   private:
+    using Columns = std::tuple<Details::BatchColumn<autobox_t<Generators>>...>;
     Function m_func;
     std::tuple<autobox_t<Generators>...> m_generators;
+
+    template<std::size_t... I>
+    void fill(Columns& columns, std::size_t count, std::index_sequence<I...>);
+    template<std::size_t... I>
+    Type apply(const Columns& columns, std::size_t index,
+      std::index_sequence<I...>);
   };
 
   template<typename FunctionFwd, typename... GeneratorsFwd>
@@ -55,6 +75,46 @@ namespace Rover {
       return m_func(evaluator.evaluate(generators)...);
     }, m_generators);
   }
+
+  template<typename F, typename... Generators>
+  struct is_batchable<Lift<F, Generators...>> : std::bool_constant<
+    (is_batchable_v<autobox_t<Generators>> && ...)> {};
+
+  template<typename F, typename... Generators>
+  struct is_static_tree<Lift<F, Generators...>> : std::bool_constant<
+    (is_static_tree_v<autobox_t<Generators>> && ...)> {};
+
+  template<typename F, typename... Generators>
+  template<typename OutputIterator>
+  OutputIterator Lift<F, Generators...>::generate_batch(std::size_t count,
+      OutputIterator out) {
+    auto columns = Columns();
+    for(auto i = std::size_t(0); i < count; i += BATCH_BLOCK_SIZE) {
+      auto size = std::min(BATCH_BLOCK_SIZE, count - i);
+      fill(columns, size, std::index_sequence_for<Generators...>());
+      for(auto j = std::size_t(0); j < size; ++j) {
+        *out = apply(columns, j, std::index_sequence_for<Generators...>());
+        ++out;
+      }
+    }
+    return out;
+  }
+
+  template<typename F, typename... Generators>
+  template<std::size_t... I>
+  void Lift<F, Generators...>::fill(Columns& columns,
+      [[maybe_unused]] std::size_t count,
+      std::index_sequence<I...>) {
+    (std::get<I>(columns).fill(std::get<I>(m_generators), count), ...);
+  }
+
+  template<typename F, typename... Generators>
+  template<std::size_t... I>
+  typename Lift<F, Generators...>::Type Lift<F, Generators...>::apply(
+      const Columns& columns, [[maybe_unused]] std::size_t index,
+      std::index_sequence<I...>) {
+    return m_func(std::get<I>(columns)[index]...);
+  }
 }
 
 #endif
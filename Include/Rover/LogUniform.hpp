@@ -0,0 +1,290 @@
+#ifndef ROVER_LOG_UNIFORM_HPP
+#define ROVER_LOG_UNIFORM_HPP
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Rover/Autobox.hpp"
+#include "Rover/Batch.hpp"
+#include "Rover/Evaluator.hpp"
+#include "Rover/Random.hpp"
+#include "Rover/Range.hpp"
+#include "Rover/Sampling.hpp"
+
+namespace Rover {
+namespace Details {
+
+  /** Inverts the cumulative distribution function of a log-uniform
+      distribution over [begin, end]. */
+  class LogUniformQuantile {
+    public:
+      LogUniformQuantile(double begin, double end)
+        : m_begin(begin),
+          m_end(end),
+          m_ratio(std::log(end / begin)) {}
+
+      double operator ()(double fraction) const {
+        return std::clamp(m_begin * std::exp(fraction * m_ratio), m_begin,
+          m_end);
+      }
+
+    private:
+      double m_begin;
+      double m_end;
+      double m_ratio;
+  };
+}
+
+  //! Generates an argument whose logarithm is uniformly distributed within a
+  //! range of values determined by sub-generators.
+  /*!
+    \tparam B The type of generator evaluating to the beginning of the range.
+    \tparam E The type of generator evaluating to the end of the range.
+    \tparam G The type of generator used to determine the granularity of the
+              interval.
+    \tparam R The type of random engine.
+    \details Values are drawn over [begin, end] and rounded to the nearest
+             multiple of the granularity, or to the nearest integer if the
+             range is integral, and values outside of the interval are
+             redrawn. As for a Range, if no such value lies within the
+             interval, the beginning is produced, rounded.
+  */
+  template<typename B, typename E, typename G = void,
+    typename R = DefaultEngine>
+  class LogUniform {
+    public:
+
+      //! The type of generator evaluating to the beginning of the range.
+      using Begin = autobox_t<B>;
+
+      //! The type of generator evaluating to the end of the range.
+      using End = autobox_t<E>;
+
+      //! The type used to determine the granularity of the interval.
+      using Granularity = autobox_t<G>;
+
+      //! The type of random engine.
+      using Engine = R;
+
+      using Type = std::common_type_t<typename Begin::Type, typename End::Type>;
+
+      //! Constructs a LogUniform over an interval defined by its
+      //! sub-generators.
+      /*!
+        \param begin The generator evaluating to the beginning of the range,
+                     which must be positive.
+        \param end The generator evaluating to the end of the range.
+        \param interval The type of interval.
+        \details The engine is seeded with next_seed.
+        \warning begin and end must define a valid non-empty interval. No check
+                 is made if an open interval is empty, which will result in an
+                 infinite loop in generate.
+      */
+      template<typename BeginFwd, typename EndFwd>
+      LogUniform(BeginFwd&& begin, EndFwd&& end,
+        Interval interval = Interval::CLOSED);
+
+      //! Constructs a LogUniform over an interval defined by its
+      //! sub-generators.
+      /*!
+        \param begin The generator evaluating to the beginning of the range,
+                     which must be positive.
+        \param end The generator evaluating to the end of the range.
+        \param granularity The granularity of the range.
+        \param interval The type of interval.
+        \details The engine is seeded with next_seed.
+        \warning begin and end must define a valid non-empty interval. No check
+                 is made if an open interval is empty, which will result in an
+                 infinite loop in generate.
+      */
+      template<typename BeginFwd, typename EndFwd, typename GranularityFwd>
+      LogUniform(BeginFwd&& begin, EndFwd&& end, GranularityFwd&& granularity,
+        Interval interval = Interval::CLOSED);
+
+      Type generate(Evaluator& evaluator);
+
+      //! Produces independent values in bulk.
+      /*!
+        \param count The number of values to produce.
+        \param out The output iterator receiving the values.
+        \return The output iterator past the last value written.
+      */
+      template<typename OutputIterator>
+      OutputIterator generate_batch(std::size_t count, OutputIterator out);
+
+      //! Maps a fraction to the value of the distribution at that quantile,
+      //! used by quasi-random generators.
+      /*!
+        \param evaluator The evaluator keeping track of the current session.
+        \param fraction A number in [0, 1).
+      */
+      Type transform(Evaluator& evaluator, double fraction);
+
+      //! Returns the random engine.
+      Engine& get_engine();
+
+    private:
+      using GranularityPlaceholder = std::conditional_t<std::is_same_v<
+        Granularity, void>, char, Granularity>;
+      using GranularityColumn = std::conditional_t<std::is_same_v<
+        Granularity, void>, std::tuple<>, Details::BatchColumn<Granularity>>;
+      Begin m_begin;
+      End m_end;
+      GranularityPlaceholder m_granularity;
+      Interval m_interval;
+      Engine m_engine;
+
+      template<typename... GranularityType>
+      Type draw(double fraction, const Details::LogUniformQuantile& quantile,
+        const Type& begin, const Type& end,
+        const GranularityType&... granularity);
+  };
+
+  template<typename BeginFwd, typename EndFwd>
+  LogUniform(BeginFwd&&, EndFwd&&, Interval = Interval::CLOSED) ->
+    LogUniform<std::decay_t<BeginFwd>, std::decay_t<EndFwd>, void>;
+
+  template<typename BeginFwd, typename EndFwd, typename GranularityFwd>
+  LogUniform(BeginFwd&&, EndFwd&&, GranularityFwd&&,
+    Interval = Interval::CLOSED) -> LogUniform<std::decay_t<BeginFwd>,
+    std::decay_t<EndFwd>, std::decay_t<GranularityFwd>>;
+
+  template<typename B, typename E, typename G, typename R>
+  struct is_batchable<LogUniform<B, E, G, R>> : std::bool_constant<
+    is_batchable_v<typename LogUniform<B, E, G, R>::Begin> &&
+    is_batchable_v<typename LogUniform<B, E, G, R>::End> &&
+    (std::is_same_v<G, void> ||
+      is_batchable_v<typename LogUniform<B, E, G, R>::Granularity>)> {};
+
+  template<typename B, typename E, typename G, typename R>
+  struct is_static_tree<LogUniform<B, E, G, R>> : std::bool_constant<
+    is_static_tree_v<typename LogUniform<B, E, G, R>::Begin> &&
+    is_static_tree_v<typename LogUniform<B, E, G, R>::End> &&
+    (std::is_same_v<G, void> ||
+      is_static_tree_v<typename LogUniform<B, E, G, R>::Granularity>)> {};
+
+  template<typename B, typename E, typename G, typename R>
+  template<typename BeginFwd, typename EndFwd>
+  LogUniform<B, E, G, R>::LogUniform(BeginFwd&& begin, EndFwd&& end,
+      Interval interval)
+      : m_begin(std::forward<BeginFwd>(begin)),
+        m_end(std::forward<EndFwd>(end)),
+        m_interval(interval),
+        m_engine(next_seed()) {}
+
+  template<typename B, typename E, typename G, typename R>
+  template<typename BeginFwd, typename EndFwd, typename GranularityFwd>
+  LogUniform<B, E, G, R>::LogUniform(BeginFwd&& begin, EndFwd&& end,
+      GranularityFwd&& granularity, Interval interval)
+      : m_begin(std::forward<BeginFwd>(begin)),
+        m_end(std::forward<EndFwd>(end)),
+        m_granularity(std::forward<GranularityFwd>(granularity)),
+        m_interval(interval),
+        m_engine(next_seed()) {}
+
+  template<typename B, typename E, typename G, typename R>
+  typename LogUniform<B, E, G, R>::Type LogUniform<B, E, G, R>::generate(
+      Evaluator& evaluator) {
+    auto begin = evaluator.evaluate(m_begin);
+    auto end = evaluator.evaluate(m_end);
+    auto quantile = Details::LogUniformQuantile(begin, end);
+    auto fraction = Details::draw_unit(m_engine);
+    if constexpr(std::is_same_v<G, void>) {
+      return draw(fraction, quantile, begin, end);
+    } else {
+      return draw(fraction, quantile, begin, end,
+        evaluator.evaluate(m_granularity));
+    }
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  template<typename OutputIterator>
+  OutputIterator LogUniform<B, E, G, R>::generate_batch(std::size_t count,
+      OutputIterator out) {
+    auto begin = Details::BatchColumn<Begin>();
+    auto end = Details::BatchColumn<End>();
+    auto granularity = GranularityColumn();
+    auto lanes = Details::Lanes();
+    auto bounds = std::tuple<double, double>(1, 1);
+    auto quantile = Details::LogUniformQuantile(1, 1);
+    for(auto i = std::size_t(0); i < count; i += BATCH_BLOCK_SIZE) {
+      auto size = std::min(BATCH_BLOCK_SIZE, count - i);
+      begin.fill(m_begin, size);
+      end.fill(m_end, size);
+      if constexpr(!std::is_same_v<G, void>) {
+        granularity.fill(m_granularity, size);
+      }
+      for(auto j = std::size_t(0); j < size; j += SAMPLING_LANES) {
+        Details::draw_uniform(m_engine, lanes);
+        auto width = std::min(SAMPLING_LANES, size - j);
+        for(auto k = std::size_t(0); k != width; ++k) {
+          auto row = j + k;
+          auto current = std::tuple<double, double>(Type(begin[row]),
+            Type(end[row]));
+          if(current != bounds) {
+            bounds = current;
+            quantile = std::make_from_tuple<Details::LogUniformQuantile>(
+              bounds);
+          }
+          if constexpr(std::is_same_v<G, void>) {
+            *out = draw(lanes[k], quantile, begin[row], end[row]);
+          } else {
+            *out = draw(lanes[k], quantile, begin[row], end[row],
+              granularity[row]);
+          }
+          ++out;
+        }
+      }
+    }
+    return out;
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  typename LogUniform<B, E, G, R>::Type LogUniform<B, E, G, R>::transform(
+      Evaluator& evaluator, double fraction) {
+    auto begin = evaluator.evaluate(m_begin);
+    auto end = evaluator.evaluate(m_end);
+    auto value = Details::LogUniformQuantile(begin, end)(fraction);
+    if constexpr(std::is_same_v<G, void>) {
+      return Details::admit(Details::snap<Type>(value), Type(begin),
+        Type(end), m_interval);
+    } else {
+      auto granularity = evaluator.evaluate(m_granularity);
+      return Details::admit(Details::snap<Type>(value, granularity),
+        Type(begin), Type(end), m_interval, granularity);
+    }
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  typename LogUniform<B, E, G, R>::Engine&
+      LogUniform<B, E, G, R>::get_engine() {
+    return m_engine;
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  template<typename... GranularityType>
+  typename LogUniform<B, E, G, R>::Type LogUniform<B, E, G, R>::draw(
+      double fraction, const Details::LogUniformQuantile& quantile,
+      const Type& begin, const Type& end,
+      const GranularityType&... granularity) {
+    if(begin == end) {
+      return begin;
+    }
+    if(!Details::has_admissible_value(begin, end, m_interval,
+        granularity...)) {
+      return Details::snap<Type>(static_cast<double>(begin),
+        granularity...);
+    }
+    while(true) {
+      auto value = Details::snap<Type>(quantile(fraction), granularity...);
+      if(Details::is_within(value, begin, end, m_interval)) {
+        return value;
+      }
+      fraction = Details::draw_unit(m_engine);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef ROVER_MAPPED_TRIAL_HPP
+#define ROVER_MAPPED_TRIAL_HPP
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+#include "Rover/BinaryCodec.hpp"
+#include "Rover/Noncopyable.hpp"
+#include "Rover/TrialIterator.hpp"
+
+namespace Rover {
+namespace Details {
+
+  /** Maps a whole file into memory for reading. */
+  class FileMapping : private Noncopyable {
+    public:
+      explicit FileMapping(const std::string& path);
+
+      FileMapping(FileMapping&& mapping) noexcept;
+
+      ~FileMapping();
+
+      FileMapping& operator =(FileMapping&& mapping) noexcept;
+
+      const unsigned char* data() const;
+
+      std::size_t size() const;
+
+    private:
+      const unsigned char* m_data;
+      std::size_t m_size;
+
+      void unmap();
+  };
+
+#if defined(_WIN32)
+  inline FileMapping::FileMapping(const std::string& path)
+      : m_data(nullptr),
+        m_size(0) {
+    auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+      nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE) {
+      throw std::runtime_error("Unable to open " + path + ".");
+    }
+    auto size = LARGE_INTEGER();
+    if(!GetFileSizeEx(file, &size)) {
+      CloseHandle(file);
+      throw std::runtime_error("Unable to read the size of " + path + ".");
+    }
+    m_size = static_cast<std::size_t>(size.QuadPart);
+    if(m_size == 0) {
+      CloseHandle(file);
+      return;
+    }
+    auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+      nullptr);
+    CloseHandle(file);
+    if(mapping == nullptr) {
+      throw std::runtime_error("Unable to map " + path + ".");
+    }
+    m_data = static_cast<const unsigned char*>(MapViewOfFile(mapping,
+      FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if(m_data == nullptr) {
+      throw std::runtime_error("Unable to map " + path + ".");
+    }
+  }
+
+  inline void FileMapping::unmap() {
+    if(m_data) {
+      UnmapViewOfFile(m_data);
+    }
+  }
+#else
+  inline FileMapping::FileMapping(const std::string& path)
+      : m_data(nullptr),
+        m_size(0) {
+    auto file = ::open(path.c_str(), O_RDONLY);
+    if(file == -1) {
+      throw std::runtime_error("Unable to open " + path + ".");
+    }
+    struct stat status;
+    if(::fstat(file, &status) == -1) {
+      ::close(file);
+      throw std::runtime_error("Unable to read the size of " + path + ".");
+    }
+    m_size = static_cast<std::size_t>(status.st_size);
+    if(m_size == 0) {
+      ::close(file);
+      return;
+    }
+    auto data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, file, 0);
+    ::close(file);
+    if(data == MAP_FAILED) {
+      throw std::runtime_error("Unable to map " + path + ".");
+    }
+    m_data = static_cast<const unsigned char*>(data);
+  }
+
+  inline void FileMapping::unmap() {
+    if(m_data) {
+      ::munmap(const_cast<unsigned char*>(m_data), m_size);
+    }
+  }
+#endif
+
+  inline FileMapping::FileMapping(FileMapping&& mapping) noexcept
+    : m_data(std::exchange(mapping.m_data, nullptr)),
+      m_size(std::exchange(mapping.m_size, 0)) {}
+
+  inline FileMapping::~FileMapping() {
+    unmap();
+  }
+
+  inline FileMapping& FileMapping::operator =(FileMapping&& mapping)
+      noexcept {
+    if(this != &mapping) {
+      unmap();
+      m_data = std::exchange(mapping.m_data, nullptr);
+      m_size = std::exchange(mapping.m_size, 0);
+    }
+    return *this;
+  }
+
+  inline const unsigned char* FileMapping::data() const {
+    return m_data;
+  }
+
+  inline std::size_t FileMapping::size() const {
+    return m_size;
+  }
+}
+
+  //! Reads a trial saved with save_to_binary directly from a memory-mapped
+  //! file.
+  /*!
+    \tparam S The type of the samples.
+    \details The file is mapped read-only and shared, so opening is
+             immediate, pages are loaded on first access and concurrent
+             readers of the same file share the page cache. Samples are
+             returned by reference into the mapping, which must not be
+             modified while the trial is alive.
+  */
+  template<typename S>
+  class MappedTrial {
+    public:
+
+      //! The type of stored samples.
+      using Sample = S;
+
+      //! The type of the constant iterator.
+      using Iterator = TrialIterator<MappedTrial>;
+
+      //! Maps a binary trial.
+      /*!
+        \param path The path to a file written by save_to_binary.
+        \throw std::runtime_error If the file can not be mapped or does not
+                                  hold a binary trial of the same Sample
+                                  type.
+      */
+      explicit MappedTrial(const std::string& path);
+
+      //! Returns a constant iterator to the first sample
+      Iterator begin() const;
+
+      //! Returns a constant iterator to the past-the-end sample
+      Iterator end() const;
+
+      //! Number of samples in this trial.
+      std::size_t size() const;
+
+      //! Returns a sample.
+      const Sample& operator [](std::size_t index) const;
+
+    private:
+      Details::FileMapping m_mapping;
+      const Sample* m_samples;
+      std::size_t m_size;
+  };
+
+  template<typename S>
+  MappedTrial<S>::MappedTrial(const std::string& path)
+      : m_mapping(path),
+        m_samples(nullptr),
+        m_size(0) {
+    auto header = BinaryHeader();
+    if(m_mapping.size() < sizeof(header)) {
+      throw std::runtime_error("Not a binary trial.");
+    }
+    std::memcpy(&header, m_mapping.data(), sizeof(header));
+    header.validate<Sample>(m_mapping.size());
+    m_samples = reinterpret_cast<const Sample*>(m_mapping.data() +
+      header.m_data_offset);
+    m_size = static_cast<std::size_t>(header.m_count);
+  }
+
+  template<typename S>
+  typename MappedTrial<S>::Iterator MappedTrial<S>::begin() const {
+    return Iterator(*this, 0);
+  }
+
+  template<typename S>
+  typename MappedTrial<S>::Iterator MappedTrial<S>::end() const {
+    return Iterator(*this, m_size);
+  }
+
+  template<typename S>
+  std::size_t MappedTrial<S>::size() const {
+    return m_size;
+  }
+
+  template<typename S>
+  const typename MappedTrial<S>::Sample& MappedTrial<S>::operator [](
+      std::size_t index) const {
+    return m_samples[index];
+  }
+}
+
+#endif
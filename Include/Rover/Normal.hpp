@@ -0,0 +1,146 @@
+#ifndef ROVER_NORMAL_HPP
+#define ROVER_NORMAL_HPP
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "Rover/Autobox.hpp"
+#include "Rover/Batch.hpp"
+#include "Rover/Evaluator.hpp"
+#include "Rover/Random.hpp"
+#include "Rover/Sampling.hpp"
+
+namespace Rover {
+
+  //! Generates an argument from a normal distribution whose parameters are
+  //! determined by sub-generators.
+  /*!
+    \tparam M The type of generator evaluating to the mean.
+    \tparam D The type of generator evaluating to the standard deviation.
+    \tparam R The type of random engine.
+    \details Values are drawn with the ziggurat method, in bulk over blocks
+             of SAMPLING_LANES values.
+  */
+  template<typename M, typename D, typename R = DefaultEngine>
+  class Normal {
+    public:
+
+      //! The type of generator evaluating to the mean.
+      using Mean = autobox_t<M>;
+
+      //! The type of generator evaluating to the standard deviation.
+      using Deviation = autobox_t<D>;
+
+      //! The type of random engine.
+      using Engine = R;
+
+      using Type = std::common_type_t<typename Mean::Type,
+        typename Deviation::Type, double>;
+
+      //! Constructs a Normal.
+      /*!
+        \param mean The generator evaluating to the mean.
+        \param deviation The generator evaluating to the standard deviation.
+        \details The engine is seeded with next_seed.
+      */
+      template<typename MeanFwd, typename DeviationFwd>
+      Normal(MeanFwd&& mean, DeviationFwd&& deviation);
+
+      Type generate(Evaluator& evaluator);
+
+      //! Produces independent values in bulk.
+      /*!
+        \param count The number of values to produce.
+        \param out The output iterator receiving the values.
+        \return The output iterator past the last value written.
+      */
+      template<typename OutputIterator>
+      OutputIterator generate_batch(std::size_t count, OutputIterator out);
+
+      //! Maps a fraction to the value of the distribution at that quantile,
+      //! used by quasi-random generators.
+      /*!
+        \param evaluator The evaluator keeping track of the current session.
+        \param fraction A number in [0, 1), clamped away from 0 so the
+                        value stays finite.
+      */
+      Type transform(Evaluator& evaluator, double fraction);
+
+      //! Returns the random engine.
+      Engine& get_engine();
+
+    private:
+      Mean m_mean;
+      Deviation m_deviation;
+      Engine m_engine;
+  };
+
+  template<typename MeanFwd, typename DeviationFwd>
+  Normal(MeanFwd&&, DeviationFwd&&) ->
+    Normal<std::decay_t<MeanFwd>, std::decay_t<DeviationFwd>>;
+
+  template<typename M, typename D, typename R>
+  struct is_batchable<Normal<M, D, R>> : std::bool_constant<
+    is_batchable_v<typename Normal<M, D, R>::Mean> &&
+    is_batchable_v<typename Normal<M, D, R>::Deviation>> {};
+
+  template<typename M, typename D, typename R>
+  struct is_static_tree<Normal<M, D, R>> : std::bool_constant<
+    is_static_tree_v<typename Normal<M, D, R>::Mean> &&
+    is_static_tree_v<typename Normal<M, D, R>::Deviation>> {};
+
+  template<typename M, typename D, typename R>
+  template<typename MeanFwd, typename DeviationFwd>
+  Normal<M, D, R>::Normal(MeanFwd&& mean, DeviationFwd&& deviation)
+    : m_mean(std::forward<MeanFwd>(mean)),
+      m_deviation(std::forward<DeviationFwd>(deviation)),
+      m_engine(next_seed()) {}
+
+  template<typename M, typename D, typename R>
+  typename Normal<M, D, R>::Type Normal<M, D, R>::generate(
+      Evaluator& evaluator) {
+    auto mean = evaluator.evaluate(m_mean);
+    auto deviation = evaluator.evaluate(m_deviation);
+    return static_cast<Type>(mean + deviation *
+      Details::draw_normal(m_engine));
+  }
+
+  template<typename M, typename D, typename R>
+  template<typename OutputIterator>
+  OutputIterator Normal<M, D, R>::generate_batch(std::size_t count,
+      OutputIterator out) {
+    auto mean = Details::BatchColumn<Mean>();
+    auto deviation = Details::BatchColumn<Deviation>();
+    auto lanes = Details::Lanes();
+    for(auto i = std::size_t(0); i < count; i += BATCH_BLOCK_SIZE) {
+      auto size = std::min(BATCH_BLOCK_SIZE, count - i);
+      mean.fill(m_mean, size);
+      deviation.fill(m_deviation, size);
+      for(auto j = std::size_t(0); j < size; j += SAMPLING_LANES) {
+        Details::draw_normal(m_engine, lanes);
+        auto width = std::min(SAMPLING_LANES, size - j);
+        for(auto k = std::size_t(0); k != width; ++k) {
+          *out = static_cast<Type>(mean[j + k] + deviation[j + k] * lanes[k]);
+          ++out;
+        }
+      }
+    }
+    return out;
+  }
+
+  template<typename M, typename D, typename R>
+  typename Normal<M, D, R>::Type Normal<M, D, R>::transform(
+      Evaluator& evaluator, double fraction) {
+    auto mean = evaluator.evaluate(m_mean);
+    auto deviation = evaluator.evaluate(m_deviation);
+    return static_cast<Type>(mean + deviation * Details::normal_quantile(
+      std::clamp(fraction, 0x1p-53, 1 - 0x1p-53)));
+  }
+
+  template<typename M, typename D, typename R>
+  typename Normal<M, D, R>::Engine& Normal<M, D, R>::get_engine() {
+    return m_engine;
+  }
+}
+
+#endif
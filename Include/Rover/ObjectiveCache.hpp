@@ -0,0 +1,308 @@
+#ifndef ROVER_OBJECTIVE_CACHE_HPP
+#define ROVER_OBJECTIVE_CACHE_HPP
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include "Rover/Random.hpp"
+
+namespace Rover {
+
+  //! The largest number of independently locked parts of an ObjectiveCache.
+  inline constexpr auto CACHE_SHARD_COUNT = std::size_t(16);
+
+  //! Counts the lookups made in an ObjectiveCache.
+  struct CacheStatistics {
+
+    //! The number of lookups finding a result.
+    std::uint64_t m_hits;
+
+    //! The number of lookups finding no result.
+    std::uint64_t m_misses;
+
+    //! The number of results discarded to respect the capacity.
+    std::uint64_t m_evictions;
+
+    //! Returns the fraction of the lookups finding a result, or 0 if there
+    //! was no lookup.
+    double get_hit_rate() const;
+  };
+
+namespace Details {
+  template<typename T, typename = void>
+  struct is_hashable : std::false_type {};
+
+  template<typename T>
+  struct is_hashable<T, std::void_t<decltype(std::hash<T>()(
+    std::declval<const T&>())), decltype(std::declval<const T&>() ==
+    std::declval<const T&>())>> : std::true_type {};
+}
+
+  //! Tests whether a tuple of arguments can be stored in an ObjectiveCache,
+  //! that is whether every element has a std::hash and an operator ==.
+  template<typename A>
+  struct is_cacheable : std::false_type {};
+
+  template<typename... A>
+  struct is_cacheable<std::tuple<A...>> : std::bool_constant<
+    (Details::is_hashable<A>::value && ...)> {};
+
+  template<typename A>
+  inline constexpr bool is_cacheable_v = is_cacheable<A>::value;
+
+  //! Hashes a tuple of arguments by combining the std::hash of its
+  //! elements.
+  template<typename A>
+  struct ArgumentsHash {
+    std::size_t operator ()(const A& arguments) const;
+  };
+
+  //! Stores the results of a function by arguments, discarding the least
+  //! recently used results beyond a capacity.
+  /*!
+    \tparam A The type of the tuple of arguments.
+    \tparam R The type of the result.
+    \details Large caches are split into up to CACHE_SHARD_COUNT shards
+             selected by the hash of the arguments, each with its own lock
+             and its own share of the capacity, so that concurrent workers
+             rarely contend and the recency order is only kept within a
+             shard. The cache does not track evaluations in progress, so
+             workers missing the same arguments at the same time all
+             evaluate them.
+  */
+  template<typename A, typename R>
+  class ObjectiveCache {
+    public:
+
+      //! The type of the tuple of arguments.
+      using Arguments = A;
+
+      //! The type of the result.
+      using Result = R;
+
+      //! Constructs an ObjectiveCache.
+      /*!
+        \param capacity The largest number of results stored, at least one.
+      */
+      explicit ObjectiveCache(std::size_t capacity);
+
+      //! Returns the largest number of results stored.
+      std::size_t capacity() const;
+
+      //! Returns the number of results stored.
+      std::size_t size() const;
+
+      //! Looks up the result of arguments, marking it as recently used.
+      /*!
+        \param arguments The arguments.
+        \return The result, or nothing if it is not stored.
+      */
+      std::optional<Result> find(const Arguments& arguments);
+
+      //! Stores the result of arguments, replacing any previous result.
+      /*!
+        \param arguments The arguments.
+        \param result The result.
+      */
+      void insert(const Arguments& arguments, Result result);
+
+      //! Returns the result of arguments, evaluating a function on a miss.
+      /*!
+        \param arguments The arguments.
+        \param function The function called with the elements of the
+                        arguments on a miss, outside of any lock.
+      */
+      template<typename Function>
+      Result get(const Arguments& arguments, Function&& function);
+
+      //! Returns the lookup statistics.
+      CacheStatistics get_statistics() const;
+
+      //! Resets the lookup statistics.
+      void reset_statistics();
+
+      //! Discards every result.
+      void clear();
+
+    private:
+      using Entries = std::list<std::pair<Arguments, Result>>;
+      struct KeyHash {
+        std::size_t operator ()(
+          std::reference_wrapper<const Arguments> arguments) const;
+      };
+      struct KeyEqual {
+        bool operator ()(std::reference_wrapper<const Arguments> left,
+          std::reference_wrapper<const Arguments> right) const;
+      };
+      struct Shard {
+        std::mutex m_mutex;
+        std::size_t m_capacity;
+        Entries m_entries;
+        std::unordered_map<std::reference_wrapper<const Arguments>,
+          typename Entries::iterator, KeyHash, KeyEqual> m_index;
+      };
+      std::size_t m_capacity;
+      std::size_t m_shard_count;
+      std::unique_ptr<Shard[]> m_shards;
+      std::atomic<std::uint64_t> m_hits;
+      std::atomic<std::uint64_t> m_misses;
+      std::atomic<std::uint64_t> m_evictions;
+
+      Shard& get_shard(const Arguments& arguments);
+  };
+
+  inline double CacheStatistics::get_hit_rate() const {
+    auto lookups = m_hits + m_misses;
+    if(lookups == 0) {
+      return 0;
+    }
+    return static_cast<double>(m_hits) / static_cast<double>(lookups);
+  }
+
+  template<typename A>
+  std::size_t ArgumentsHash<A>::operator ()(const A& arguments) const {
+    return std::apply([](const auto&... arguments) {
+      auto hash = std::uint64_t(0);
+      ((hash = Details::mix_seed(hash ^ std::hash<std::decay_t<
+        decltype(arguments)>>()(arguments))), ...);
+      return static_cast<std::size_t>(hash);
+    }, arguments);
+  }
+
+  template<typename A, typename R>
+  ObjectiveCache<A, R>::ObjectiveCache(std::size_t capacity)
+      : m_capacity(std::max(std::size_t(1), capacity)),
+        m_shard_count(1),
+        m_hits(0),
+        m_misses(0),
+        m_evictions(0) {
+    constexpr auto MINIMUM_SHARD_CAPACITY = std::size_t(64);
+    while(m_shard_count < CACHE_SHARD_COUNT &&
+        2 * m_shard_count * MINIMUM_SHARD_CAPACITY <= m_capacity) {
+      m_shard_count *= 2;
+    }
+    m_shards = std::make_unique<Shard[]>(m_shard_count);
+    for(auto i = std::size_t(0); i != m_shard_count; ++i) {
+      m_shards[i].m_capacity = m_capacity / m_shard_count +
+        (i < m_capacity % m_shard_count ? 1 : 0);
+    }
+  }
+
+  template<typename A, typename R>
+  std::size_t ObjectiveCache<A, R>::capacity() const {
+    return m_capacity;
+  }
+
+  template<typename A, typename R>
+  std::size_t ObjectiveCache<A, R>::size() const {
+    auto size = std::size_t(0);
+    for(auto i = std::size_t(0); i != m_shard_count; ++i) {
+      auto lock = std::lock_guard(m_shards[i].m_mutex);
+      size += m_shards[i].m_entries.size();
+    }
+    return size;
+  }
+
+  template<typename A, typename R>
+  std::optional<typename ObjectiveCache<A, R>::Result>
+      ObjectiveCache<A, R>::find(const Arguments& arguments) {
+    auto& shard = get_shard(arguments);
+    auto lock = std::lock_guard(shard.m_mutex);
+    auto entry = shard.m_index.find(std::cref(arguments));
+    if(entry == shard.m_index.end()) {
+      m_misses.fetch_add(1, std::memory_order_relaxed);
+      return std::nullopt;
+    }
+    m_hits.fetch_add(1, std::memory_order_relaxed);
+    shard.m_entries.splice(shard.m_entries.begin(), shard.m_entries,
+      entry->second);
+    return entry->second->second;
+  }
+
+  template<typename A, typename R>
+  void ObjectiveCache<A, R>::insert(const Arguments& arguments,
+      Result result) {
+    auto& shard = get_shard(arguments);
+    auto lock = std::lock_guard(shard.m_mutex);
+    auto entry = shard.m_index.find(std::cref(arguments));
+    if(entry != shard.m_index.end()) {
+      entry->second->second = std::move(result);
+      shard.m_entries.splice(shard.m_entries.begin(), shard.m_entries,
+        entry->second);
+      return;
+    }
+    if(shard.m_entries.size() == shard.m_capacity) {
+      shard.m_index.erase(std::cref(shard.m_entries.back().first));
+      shard.m_entries.pop_back();
+      m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+    shard.m_entries.emplace_front(arguments, std::move(result));
+    shard.m_index.emplace(std::cref(shard.m_entries.front().first),
+      shard.m_entries.begin());
+  }
+
+  template<typename A, typename R>
+  template<typename Function>
+  typename ObjectiveCache<A, R>::Result ObjectiveCache<A, R>::get(
+      const Arguments& arguments, Function&& function) {
+    if(auto result = find(arguments)) {
+      return std::move(*result);
+    }
+    auto result = std::apply(std::forward<Function>(function), arguments);
+    insert(arguments, result);
+    return result;
+  }
+
+  template<typename A, typename R>
+  CacheStatistics ObjectiveCache<A, R>::get_statistics() const {
+    return CacheStatistics{m_hits.load(), m_misses.load(),
+      m_evictions.load()};
+  }
+
+  template<typename A, typename R>
+  void ObjectiveCache<A, R>::reset_statistics() {
+    m_hits = 0;
+    m_misses = 0;
+    m_evictions = 0;
+  }
+
+  template<typename A, typename R>
+  void ObjectiveCache<A, R>::clear() {
+    for(auto i = std::size_t(0); i != m_shard_count; ++i) {
+      auto lock = std::lock_guard(m_shards[i].m_mutex);
+      m_shards[i].m_index.clear();
+      m_shards[i].m_entries.clear();
+    }
+  }
+
+  template<typename A, typename R>
+  std::size_t ObjectiveCache<A, R>::KeyHash::operator ()(
+      std::reference_wrapper<const Arguments> arguments) const {
+    return ArgumentsHash<Arguments>()(arguments.get());
+  }
+
+  template<typename A, typename R>
+  bool ObjectiveCache<A, R>::KeyEqual::operator ()(
+      std::reference_wrapper<const Arguments> left,
+      std::reference_wrapper<const Arguments> right) const {
+    return left.get() == right.get();
+  }
+
+  template<typename A, typename R>
+  typename ObjectiveCache<A, R>::Shard& ObjectiveCache<A, R>::get_shard(
+      const Arguments& arguments) {
+    auto hash = Details::mix_seed(ArgumentsHash<Arguments>()(arguments));
+    return m_shards[hash & (m_shard_count - 1)];
+  }
+}
+
+#endif
@@ -1,16 +1,55 @@
 #ifndef ROVER_PICK_HPP
 #define ROVER_PICK_HPP
+#include <algorithm>
+#include <array>
+#include <iterator>
 #include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
+#include "Rover/Batch.hpp"
 #include "Rover/Evaluator.hpp"
 
 namespace Rover {
+namespace Details {
+
+  /** Returns a table of functions evaluating each element of a tuple of
+      generators, so that the element chosen at runtime is evaluated with a
+      single indirect call. */
+  template<typename R, typename T, std::size_t... I>
+  constexpr auto make_dispatch_table(std::index_sequence<I...>) {
+    return std::array<R (*)(T&, Evaluator&), sizeof...(I)>{
+      [](T& tuple, Evaluator& evaluator) -> R {
+        return evaluator.evaluate(std::get<I>(tuple));
+      }...};
+  }
+
+  /** Returns the index of the generator to evaluate for a choice, falling
+      back to the first generator when the choice is out of range. */
+  template<std::size_t N, typename T>
+  std::size_t to_pick_index(T choice) {
+    if constexpr(std::is_signed_v<T>) {
+      if(choice < 0) {
+        return 0;
+      }
+    }
+    auto index = static_cast<std::size_t>(choice);
+    if(index >= N) {
+      return 0;
+    }
+    return index;
+  }
+}
 
   //! An argument generator that evaluates to one of the arguments based on
   //! the result of a choice generator.
   /*!
     \tparam C The type of the choice generator.
     \tparam G The types of the generators.
+    \details The chosen generator is evaluated through a table of function
+             pointers, in constant time regardless of the number of
+             generators. A choice out of range evaluates the first
+             generator.
   */
   template<typename C, typename... G>
   class Pick {
@@ -41,9 +80,34 @@ namespace Rover {
       //! Evaluates the generator.
       Type generate(Evaluator& evaluator);
 
+      //! Returns the choice generator.
+      Choice& get_choice();
+
+      //! Returns the choice generator.
+      const Choice& get_choice() const;
+
+      //! Produces independent values in bulk.
+      /*!
+        \param count The number of values to produce.
+        \param out The output iterator receiving the values.
+        \return The output iterator past the last value written.
+        \details A block of choices is produced first, then each generator
+                 produces as many values as it was chosen in that block.
+      */
+      template<typename OutputIterator>
+      OutputIterator generate_batch(std::size_t count, OutputIterator out);
+
     private:
+      using Alternatives = std::array<std::vector<Type>, sizeof...(G)>;
+      using Counts = std::array<std::size_t, sizeof...(G)>;
+      static constexpr auto DISPATCH_TABLE = Details::make_dispatch_table<
+        Type, Generators>(std::index_sequence_for<G...>());
       Choice m_choice;
       Generators m_generators;
+
+      template<std::size_t... I>
+      void fill(Alternatives& alternatives, const Counts& counts,
+        std::index_sequence<I...>);
   };
 
   template<typename ChoiceFwd, typename GeneratorFwd, typename...
@@ -60,32 +124,65 @@ namespace Rover {
       m_generators(std::forward<GeneratorFwd>(generator), std::forward<
         GeneratorsFwd>(generators)...) {}
 
-namespace Details {
-  template<typename T, int I = std::tuple_size_v<T> - 1>
-  struct ByIndexEvaluator {
-    static auto evaluate(T& tuple, Evaluator& evaluator, int index) {
-      if(I == index) {
-        return evaluator.evaluate(std::get<I>(tuple));
-      } else {
-        return ByIndexEvaluator<T, I - 1>::evaluate(tuple, evaluator, index);
-      }
-    }
-  };
+  template<typename C, typename... G>
+  typename Pick<C, G...>::Type Pick<C, G...>::generate(Evaluator& evaluator) {
+    auto index = Details::to_pick_index<sizeof...(G)>(
+      evaluator.evaluate(m_choice));
+    return DISPATCH_TABLE[index](m_generators, evaluator);
+  }
+
+  template<typename C, typename... G>
+  typename Pick<C, G...>::Choice& Pick<C, G...>::get_choice() {
+    return m_choice;
+  }
+
+  template<typename C, typename... G>
+  const typename Pick<C, G...>::Choice& Pick<C, G...>::get_choice() const {
+    return m_choice;
+  }
+
+  template<typename C, typename... G>
+  struct is_batchable<Pick<C, G...>> : std::bool_constant<
+    is_batchable_v<C> && (is_batchable_v<G> && ...)> {};
+
+  template<typename C, typename... G>
+  struct is_static_tree<Pick<C, G...>> : std::bool_constant<
+    is_static_tree_v<C> && (is_static_tree_v<G> && ...)> {};
 
-  template<typename T>
-  struct ByIndexEvaluator<T, 0> {
-    static auto evaluate(T& tuple, Evaluator& evaluator, int) {
-      return evaluator.evaluate(std::get<0>(tuple));
+  template<typename C, typename... G>
+  template<typename OutputIterator>
+  OutputIterator Pick<C, G...>::generate_batch(std::size_t count,
+      OutputIterator out) {
+    auto choices = Details::BatchColumn<Choice>();
+    auto alternatives = Alternatives();
+    for(auto i = std::size_t(0); i < count; i += BATCH_BLOCK_SIZE) {
+      auto size = std::min(BATCH_BLOCK_SIZE, count - i);
+      choices.fill(m_choice, size);
+      auto indices = std::array<std::size_t, BATCH_BLOCK_SIZE>();
+      auto counts = Counts();
+      for(auto j = std::size_t(0); j < size; ++j) {
+        indices[j] = Details::to_pick_index<sizeof...(G)>(choices[j]);
+        ++counts[indices[j]];
+      }
+      fill(alternatives, counts, std::index_sequence_for<G...>());
+      auto positions = Counts();
+      for(auto j = std::size_t(0); j < size; ++j) {
+        auto index = indices[j];
+        *out = std::move(alternatives[index][positions[index]]);
+        ++positions[index];
+        ++out;
+      }
     }
-  };
-}
+    return out;
+  }
 
   template<typename C, typename... G>
-  typename Pick<C, G...>::Type Pick<C, G...>::generate(Evaluator& evaluator) {
-    auto index = evaluator.evaluate(m_choice);
-    auto value = Details::ByIndexEvaluator<Generators>::evaluate(m_generators,
-      evaluator, index);
-    return value;
+  template<std::size_t... I>
+  void Pick<C, G...>::fill(Alternatives& alternatives, const Counts& counts,
+      std::index_sequence<I...>) {
+    ((std::get<I>(alternatives).clear(), Rover::generate_batch(
+      std::get<I>(m_generators), std::get<I>(counts), std::back_inserter(
+      std::get<I>(alternatives)))), ...);
   }
 }
 
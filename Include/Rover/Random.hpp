@@ -0,0 +1,243 @@
+#ifndef ROVER_RANDOM_HPP
+#define ROVER_RANDOM_HPP
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include "Rover/Noncopyable.hpp"
+
+namespace Rover {
+
+  //! Counter-based random engine implementing Philox4x32-10.
+  /*!
+    \details The engine encrypts a 128-bit counter under a 64-bit key. The
+             counter is split into a 64-bit stream and a 64-bit position, so
+             the whole state is a few words, independent streams are obtained
+             by changing the stream alone and discard runs in constant time.
+  */
+  class PhiloxEngine {
+    public:
+
+      //! The type of the values produced.
+      using result_type = std::uint32_t;
+
+      //! Constructs a PhiloxEngine with a seed of 0.
+      PhiloxEngine();
+
+      //! Constructs a PhiloxEngine.
+      /*!
+        \param seed The key of the engine.
+        \param stream The stream within the key.
+      */
+      explicit PhiloxEngine(std::uint64_t seed, std::uint64_t stream = 0);
+
+      //! Restarts the engine.
+      /*!
+        \param seed The key of the engine.
+        \param stream The stream within the key.
+      */
+      void seed(std::uint64_t seed, std::uint64_t stream = 0);
+
+      //! Returns the next value.
+      result_type operator ()();
+
+      //! Skips values in constant time.
+      /*!
+        \param count The number of values to skip.
+      */
+      void discard(unsigned long long count);
+
+      //! Returns the smallest value produced.
+      static constexpr result_type min();
+
+      //! Returns the largest value produced.
+      static constexpr result_type max();
+
+      bool operator ==(const PhiloxEngine& engine) const;
+
+      bool operator !=(const PhiloxEngine& engine) const;
+
+    private:
+      std::uint64_t m_key;
+      std::uint64_t m_stream;
+      std::uint64_t m_position;
+      std::array<result_type, 4> m_buffer;
+
+      std::array<result_type, 4> encrypt(std::uint64_t block) const;
+  };
+
+  //! The engine used by random generators by default.
+  using DefaultEngine = PhiloxEngine;
+
+  //! Derives an independent seed from a parent seed.
+  /*!
+    \param seed The parent seed.
+    \param index The index of the child.
+    \return A seed statistically independent from the parent and from the
+            other children.
+  */
+  std::uint64_t derive_seed(std::uint64_t seed, std::uint64_t index);
+
+  //! Sets the root of the seed hierarchy, making the seeds returned by
+  //! next_seed reproducible.
+  /*!
+    \param seed The root seed.
+    \details By default the root seed is drawn from std::random_device. This
+             function is not synchronized with concurrent calls to
+             next_seed.
+  */
+  void set_root_seed(std::uint64_t seed);
+
+  //! Returns the next seed of the innermost SeedScope of the calling thread,
+  //! or of the root seed if there is none.
+  /*!
+    \details Random generators seed their engine with this function on
+             construction.
+  */
+  std::uint64_t next_seed();
+
+  //! Overrides the seeds returned by next_seed on the current thread for its
+  //! lifetime.
+  class SeedScope : private Noncopyable {
+    public:
+
+      //! Constructs a SeedScope.
+      /*!
+        \param seed The seed from which the scope's seeds are derived.
+      */
+      explicit SeedScope(std::uint64_t seed);
+
+      ~SeedScope();
+
+    private:
+      friend std::uint64_t next_seed();
+      std::uint64_t m_seed;
+      std::uint64_t m_count;
+      SeedScope* m_previous;
+
+      static SeedScope*& get_current();
+  };
+
+namespace Details {
+  inline std::uint64_t mix_seed(std::uint64_t value) {
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+  }
+
+  inline std::atomic<std::uint64_t>& get_root_seed() {
+    static auto seed = std::atomic<std::uint64_t>(
+      (static_cast<std::uint64_t>(std::random_device()()) << 32) ^
+      std::random_device()());
+    return seed;
+  }
+
+  inline std::atomic<std::uint64_t>& get_root_count() {
+    static auto count = std::atomic<std::uint64_t>(0);
+    return count;
+  }
+}
+
+  inline PhiloxEngine::PhiloxEngine()
+    : PhiloxEngine(0) {}
+
+  inline PhiloxEngine::PhiloxEngine(std::uint64_t seed, std::uint64_t stream) {
+    this->seed(seed, stream);
+  }
+
+  inline void PhiloxEngine::seed(std::uint64_t seed, std::uint64_t stream) {
+    m_key = seed;
+    m_stream = stream;
+    m_position = 0;
+    m_buffer = {};
+  }
+
+  inline PhiloxEngine::result_type PhiloxEngine::operator ()() {
+    auto index = m_position & 3;
+    if(index == 0) {
+      m_buffer = encrypt(m_position >> 2);
+    }
+    ++m_position;
+    return m_buffer[index];
+  }
+
+  inline void PhiloxEngine::discard(unsigned long long count) {
+    m_position += count;
+    if((m_position & 3) != 0) {
+      m_buffer = encrypt(m_position >> 2);
+    }
+  }
+
+  constexpr PhiloxEngine::result_type PhiloxEngine::min() {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  constexpr PhiloxEngine::result_type PhiloxEngine::max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  inline bool PhiloxEngine::operator ==(const PhiloxEngine& engine) const {
+    return m_key == engine.m_key && m_stream == engine.m_stream &&
+      m_position == engine.m_position;
+  }
+
+  inline bool PhiloxEngine::operator !=(const PhiloxEngine& engine) const {
+    return !(*this == engine);
+  }
+
+  inline std::array<PhiloxEngine::result_type, 4> PhiloxEngine::encrypt(
+      std::uint64_t block) const {
+    auto counter = std::array<result_type, 4>{static_cast<result_type>(block),
+      static_cast<result_type>(block >> 32), static_cast<result_type>(
+      m_stream), static_cast<result_type>(m_stream >> 32)};
+    auto key = std::array<result_type, 2>{static_cast<result_type>(m_key),
+      static_cast<result_type>(m_key >> 32)};
+    for(auto i = 0; i < 10; ++i) {
+      auto first = std::uint64_t(0xD2511F53) * counter[0];
+      auto second = std::uint64_t(0xCD9E8D57) * counter[2];
+      counter = {static_cast<result_type>(second >> 32) ^ counter[1] ^ key[0],
+        static_cast<result_type>(second), static_cast<result_type>(
+        first >> 32) ^ counter[3] ^ key[1], static_cast<result_type>(first)};
+      key[0] += 0x9E3779B9;
+      key[1] += 0xBB67AE85;
+    }
+    return counter;
+  }
+
+  inline std::uint64_t derive_seed(std::uint64_t seed, std::uint64_t index) {
+    return Details::mix_seed(seed ^ Details::mix_seed(index));
+  }
+
+  inline void set_root_seed(std::uint64_t seed) {
+    Details::get_root_seed() = seed;
+    Details::get_root_count() = 0;
+  }
+
+  inline std::uint64_t next_seed() {
+    if(auto scope = SeedScope::get_current()) {
+      return derive_seed(scope->m_seed, scope->m_count++);
+    }
+    return derive_seed(Details::get_root_seed(),
+      Details::get_root_count()++);
+  }
+
+  inline SeedScope::SeedScope(std::uint64_t seed)
+      : m_seed(seed),
+        m_count(0),
+        m_previous(get_current()) {
+    get_current() = this;
+  }
+
+  inline SeedScope::~SeedScope() {
+    get_current() = m_previous;
+  }
+
+  inline SeedScope*& SeedScope::get_current() {
+    thread_local auto current = static_cast<SeedScope*>(nullptr);
+    return current;
+  }
+}
+
+#endif
@@ -1,5 +1,6 @@
 #ifndef ROVER_RANDOM_PICK_HPP
 #define ROVER_RANDOM_PICK_HPP
+#include "Rover/Batch.hpp"
 #include "Rover/Evaluator.hpp"
 #include "Rover/Pick.hpp"
 #include "Rover/Range.hpp"
@@ -31,6 +32,15 @@ namespace Rover {
       //! Evaluates the generator.
       Type generate(Evaluator& evaluator);
 
+      //! Produces independent values in bulk.
+      /*!
+        \param count The number of values to produce.
+        \param out The output iterator receiving the values.
+        \return The output iterator past the last value written.
+      */
+      template<typename OutputIterator>
+      OutputIterator generate_batch(std::size_t count, OutputIterator out);
+
     private:
       PickType m_pick;
   };
@@ -54,6 +64,21 @@ namespace Rover {
       evaluator) {
     return m_pick.generate(evaluator);
   }
+
+  template<typename... G>
+  struct is_batchable<RandomPick<G...>> : std::bool_constant<
+    is_batchable_v<Pick<Range<int, int>, G...>>> {};
+
+  template<typename... G>
+  struct is_static_tree<RandomPick<G...>> : std::bool_constant<
+    is_static_tree_v<Pick<Range<int, int>, G...>>> {};
+
+  template<typename... G>
+  template<typename OutputIterator>
+  OutputIterator RandomPick<G...>::generate_batch(std::size_t count,
+      OutputIterator out) {
+    return m_pick.generate_batch(count, std::move(out));
+  }
 }
 
 #endif
@@ -1,12 +1,18 @@
 #ifndef ROVER_RANGE_HPP
 #define ROVER_RANGE_HPP
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <random>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include "Rover/Autobox.hpp"
+#include "Rover/Batch.hpp"
 #include "Rover/Evaluator.hpp"
+#include "Rover/Random.hpp"
 
 namespace Rover {
 
@@ -34,8 +40,10 @@ namespace Rover {
     \tparam E The type of generator evaluating to the end of the range.
     \tparam G The type of generator used to determine the granularity of the
               interval.
+    \tparam R The type of random engine.
   */
-  template<typename B, typename E, typename G = void>
+  template<typename B, typename E, typename G = void,
+    typename R = DefaultEngine>
   class Range {
     public:
 
@@ -48,6 +56,9 @@ namespace Rover {
       //! The type used to determine the granularity of the interval.
       using Granularity = autobox_t<G>;
 
+      //! The type of random engine.
+      using Engine = R;
+
       using Type = std::common_type_t<typename Begin::Type, typename End::Type>;
 
       //! Constructs a Range over an interval defined by its sub-generators.
@@ -55,9 +66,11 @@ namespace Rover {
         \param begin The generator evaluating to the beginning of the range.
         \param end The generator evaluating to the end of the range.
         \param interval The type of interval.
-        \warning begin and end must define a valid non-empty interval. No check
-                 is made if an open interval is empty, which will result in an
-                 infinite loop in generate.
+        \details The engine is seeded with next_seed.
+        \warning begin and end must define a valid interval. An empty open
+                 interval of arithmetic values generates begin, for other
+                 types no check is made, which will result in an infinite
+                 loop in generate.
       */
       template<typename BeginFwd, typename EndFwd>
       Range(BeginFwd&& begin, EndFwd&& end,
@@ -69,9 +82,11 @@ namespace Rover {
         \param end The generator evaluating to the end of the range.
         \param granularity The granularity of the range.
         \param interval The type of interval.
-        \warning begin and end must define a valid non-empty interval. No check
-                 is made if an open interval is empty, which will result in an
-                 infinite loop in generate.
+        \details The engine is seeded with next_seed.
+        \warning begin and end must define a valid interval. An empty open
+                 interval of arithmetic values generates begin, for other
+                 types no check is made, which will result in an infinite
+                 loop in generate.
       */
       template<typename BeginFwd, typename EndFwd, typename GranularityFwd>
       Range(BeginFwd&& begin, EndFwd&& end, GranularityFwd&& granularity,
@@ -79,20 +94,70 @@ namespace Rover {
 
       Type generate(Evaluator& evaluator);
 
+      //! Produces independent values in bulk.
+      /*!
+        \param count The number of values to produce.
+        \param out The output iterator receiving the values.
+        \return The output iterator past the last value written.
+      */
+      template<typename OutputIterator>
+      OutputIterator generate_batch(std::size_t count, OutputIterator out);
+
+      //! Maps a fraction of the range to one of its values, used by
+      //! quasi-random generators.
+      /*!
+        \param evaluator The evaluator keeping track of the current session.
+        \param fraction A number in [0, 1).
+        \return The value found at the given fraction of the way through the
+                range's values, respecting the interval and granularity.
+      */
+      Type transform(Evaluator& evaluator, double fraction);
+
+      //! Returns the number of distinct values in the range, which must be
+      //! integral or have a granularity.
+      /*!
+        \param evaluator The evaluator keeping track of the current session.
+      */
+      std::uint64_t size(Evaluator& evaluator);
+
+      //! Returns a value of the range by its position in ascending order,
+      //! used by generators enumerating the range.
+      /*!
+        \param evaluator The evaluator keeping track of the current session.
+        \param index The position of the value, less than size.
+      */
+      Type at(Evaluator& evaluator, std::uint64_t index);
+
+      //! Returns the random engine.
+      Engine& get_engine();
+
     private:
       using GranularityPlaceholder = std::conditional_t<std::is_same_v<
         Granularity, void>, char, Granularity>;
+      using GranularityColumn = std::conditional_t<std::is_same_v<
+        Granularity, void>, std::tuple<>, Details::BatchColumn<Granularity>>;
       Begin m_begin;
       End m_end;
       GranularityPlaceholder m_granularity;
       Interval m_interval;
-      std::mt19937 m_engine;
+      Engine m_engine;
       std::uniform_real_distribution<double> m_distribution;
 
+      template<typename... GranularityType>
+      Type draw(const Type& begin, const Type& end,
+        const GranularityType&... granularity);
+      template<typename Sampler, typename... GranularityType>
+      Type locate(const Type& begin, const Type& end, Sampler&& sampler,
+        const GranularityType&... granularity);
+      template<typename... GranularityType>
+      Type reject(const Type& begin, const Type& end,
+        const GranularityType&... granularity);
+      bool is_after_begin(const Type& value, const Type& begin) const;
+      bool is_before_end(const Type& value, const Type& end) const;
       Type calculate_random(const Type& begin, const Type& end);
       Type pick_random(const Type& lhs, const Type& rhs);
-      template<typename TypeFwd>
-      Type round(Evaluator& evaluator, TypeFwd&& value);
+      template<typename TypeFwd, typename... GranularityType>
+      Type round(TypeFwd&& value, const GranularityType&... granularity);
   };
 
   template<typename BeginFwd, typename EndFwd>
@@ -104,35 +169,235 @@ namespace Rover {
     Range<std::decay_t<BeginFwd>, std::decay_t<EndFwd>,
     std::decay_t<GranularityFwd>>;
 
-  template<typename B, typename E, typename G>
+  template<typename B, typename E, typename G, typename R>
   template<typename BeginFwd, typename EndFwd>
-  Range<B, E, G>::Range(BeginFwd&& begin, EndFwd&& end,
+  Range<B, E, G, R>::Range(BeginFwd&& begin, EndFwd&& end,
       Interval interval)
       : m_begin(std::forward<BeginFwd>(begin)),
         m_end(std::forward<EndFwd>(end)),
+        m_granularity(),
         m_interval(interval),
-        m_engine(std::random_device()()),
+        m_engine(next_seed()),
         m_distribution(0., 1.) {}
 
-  template<typename B, typename E, typename G>
+  template<typename B, typename E, typename G, typename R>
   template<typename BeginFwd, typename EndFwd, typename GranularityFwd>
-  Range<B, E, G>::Range(BeginFwd&& begin, EndFwd&& end,
+  Range<B, E, G, R>::Range(BeginFwd&& begin, EndFwd&& end,
       GranularityFwd&& granularity, Interval interval)
       : m_begin(std::forward<BeginFwd>(begin)),
         m_end(std::forward<EndFwd>(end)),
         m_granularity(std::forward<GranularityFwd>(granularity)),
         m_interval(interval),
-        m_engine(std::random_device()()),
+        m_engine(next_seed()),
         m_distribution(0., 1.) {}
 
-  template<typename B, typename E, typename G>
-  typename Range<B, E, G>::Type Range<B, E, G>::generate(
+  template<typename B, typename E, typename G, typename R>
+  struct is_batchable<Range<B, E, G, R>> : std::bool_constant<
+    is_batchable_v<typename Range<B, E, G, R>::Begin> &&
+    is_batchable_v<typename Range<B, E, G, R>::End> &&
+    (std::is_same_v<G, void> ||
+      is_batchable_v<typename Range<B, E, G, R>::Granularity>)> {};
+
+  template<typename B, typename E, typename G, typename R>
+  struct is_static_tree<Range<B, E, G, R>> : std::bool_constant<
+    is_static_tree_v<typename Range<B, E, G, R>::Begin> &&
+    is_static_tree_v<typename Range<B, E, G, R>::End> &&
+    (std::is_same_v<G, void> ||
+      is_static_tree_v<typename Range<B, E, G, R>::Granularity>)> {};
+
+  template<typename B, typename E, typename G, typename R>
+  typename Range<B, E, G, R>::Type Range<B, E, G, R>::generate(
       Evaluator& evaluator) {
     auto begin = evaluator.evaluate(m_begin);
     auto end = evaluator.evaluate(m_end);
+    if constexpr(std::is_same_v<G, void>) {
+      return draw(begin, end);
+    } else {
+      return draw(begin, end, evaluator.evaluate(m_granularity));
+    }
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  template<typename OutputIterator>
+  OutputIterator Range<B, E, G, R>::generate_batch(std::size_t count,
+      OutputIterator out) {
+    auto begin = Details::BatchColumn<Begin>();
+    auto end = Details::BatchColumn<End>();
+    auto granularity = GranularityColumn();
+    for(auto i = std::size_t(0); i < count; i += BATCH_BLOCK_SIZE) {
+      auto size = std::min(BATCH_BLOCK_SIZE, count - i);
+      begin.fill(m_begin, size);
+      end.fill(m_end, size);
+      if constexpr(std::is_same_v<G, void>) {
+        for(auto j = std::size_t(0); j < size; ++j) {
+          *out = draw(begin[j], end[j]);
+          ++out;
+        }
+      } else {
+        granularity.fill(m_granularity, size);
+        for(auto j = std::size_t(0); j < size; ++j) {
+          *out = draw(begin[j], end[j], granularity[j]);
+          ++out;
+        }
+      }
+    }
+    return out;
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  typename Range<B, E, G, R>::Engine& Range<B, E, G, R>::get_engine() {
+    return m_engine;
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  typename Range<B, E, G, R>::Type Range<B, E, G, R>::transform(
+      Evaluator& evaluator, double fraction) {
+    static_assert(std::is_arithmetic_v<Type>);
+    auto begin = evaluator.evaluate(m_begin);
+    auto end = evaluator.evaluate(m_end);
+    auto sampler = [&](auto low, auto high) {
+      using Bound = decltype(low);
+      if constexpr(std::is_integral_v<Bound>) {
+        auto span = static_cast<long double>(high) - low + 1;
+        return std::min(high, static_cast<Bound>(low + static_cast<Bound>(
+          fraction * span)));
+      } else {
+        return std::min(high, static_cast<Bound>(low + fraction *
+          (high - low)));
+      }
+    };
     if(begin == end) {
       return begin;
+    } else if constexpr(std::is_same_v<G, void>) {
+      return locate(begin, end, sampler);
+    } else {
+      return locate(begin, end, sampler, evaluator.evaluate(m_granularity));
     }
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  std::uint64_t Range<B, E, G, R>::size(Evaluator& evaluator) {
+    static_assert(std::is_integral_v<Type> || !std::is_same_v<G, void>);
+    auto begin = evaluator.evaluate(m_begin);
+    auto end = evaluator.evaluate(m_end);
+    auto count = std::uint64_t(0);
+    auto sampler = [&](auto low, auto high) {
+      count = static_cast<std::uint64_t>(high - low) + 1;
+      return low;
+    };
+    if(begin == end) {
+      return 1;
+    } else if constexpr(std::is_same_v<G, void>) {
+      locate(begin, end, sampler);
+    } else {
+      locate(begin, end, sampler, evaluator.evaluate(m_granularity));
+    }
+    return count;
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  typename Range<B, E, G, R>::Type Range<B, E, G, R>::at(Evaluator& evaluator,
+      std::uint64_t index) {
+    static_assert(std::is_integral_v<Type> || !std::is_same_v<G, void>);
+    auto begin = evaluator.evaluate(m_begin);
+    auto end = evaluator.evaluate(m_end);
+    auto sampler = [&](auto low, auto) {
+      return static_cast<decltype(low)>(low + index);
+    };
+    if(begin == end) {
+      return begin;
+    } else if constexpr(std::is_same_v<G, void>) {
+      return locate(begin, end, sampler);
+    } else {
+      return locate(begin, end, sampler, evaluator.evaluate(m_granularity));
+    }
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  template<typename... GranularityType>
+  typename Range<B, E, G, R>::Type Range<B, E, G, R>::draw(const Type& begin,
+      const Type& end, const GranularityType&... granularity) {
+    if(begin == end) {
+      return begin;
+    }
+    if constexpr(!std::is_arithmetic_v<Type> ||
+        !(std::is_arithmetic_v<GranularityType> && ...)) {
+      return reject(begin, end, granularity...);
+    } else {
+      return locate(begin, end, [&](auto low, auto high) {
+        using Bound = decltype(low);
+        if constexpr(std::is_integral_v<Bound>) {
+          return std::uniform_int_distribution<Bound>(low, high)(m_engine);
+        } else {
+          return std::min(high, std::uniform_real_distribution<Bound>(low,
+            std::nextafter(high, std::numeric_limits<Bound>::infinity()))(
+            m_engine));
+        }
+      }, granularity...);
+    }
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  template<typename Sampler, typename... GranularityType>
+  typename Range<B, E, G, R>::Type Range<B, E, G, R>::locate(
+      const Type& begin, const Type& end, Sampler&& sampler,
+      const GranularityType&... granularity) {
+    if constexpr(sizeof...(GranularityType) != 0) {
+      const auto& step = std::get<0>(std::tie(granularity...));
+      auto granule = [&](long long index) {
+        return static_cast<Type>(step * index);
+      };
+      auto low = static_cast<long long>(std::ceil(static_cast<long double>(
+        begin) / step));
+      while(!is_after_begin(granule(low), begin)) {
+        ++low;
+      }
+      while(is_after_begin(granule(low - 1), begin)) {
+        --low;
+      }
+      auto high = static_cast<long long>(std::floor(static_cast<long double>(
+        end) / step));
+      while(!is_before_end(granule(high), end)) {
+        --high;
+      }
+      while(is_before_end(granule(high + 1), end)) {
+        ++high;
+      }
+      if(low > high) {
+        return round(begin, granularity...);
+      }
+      return granule(sampler(low, high));
+    } else if constexpr(std::is_integral_v<Type>) {
+      using Wide = std::conditional_t<std::is_signed_v<Type>, long long,
+        unsigned long long>;
+      auto low = static_cast<Wide>(begin);
+      auto high = static_cast<Wide>(end);
+      if(!is_after_begin(begin, begin)) {
+        ++low;
+      }
+      if(!is_before_end(end, end)) {
+        --high;
+      }
+      if(low > high) {
+        return begin;
+      }
+      return static_cast<Type>(sampler(low, high));
+    } else {
+      auto low = is_after_begin(begin, begin) ? begin :
+        std::nextafter(begin, end);
+      auto high = is_before_end(end, end) ? end : std::nextafter(end, begin);
+      if(low > high) {
+        return begin;
+      }
+      return sampler(low, high);
+    }
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  template<typename... GranularityType>
+  typename Range<B, E, G, R>::Type Range<B, E, G, R>::reject(
+      const Type& begin, const Type& end,
+      const GranularityType&... granularity) {
     while(true) {
       auto value = calculate_random(begin, end + end);
       auto alt_value = calculate_random(begin, end + end);
@@ -143,34 +408,35 @@ namespace Rover {
       } else if(value >= end) {
         continue;
       }
-      auto result = round(evaluator, std::move(value));
-      switch(m_interval) {
-        case Interval::CLOSED:
-          if(result >= begin && result <= end) {
-            return result;
-          }
-          break;
-        case Interval::LEFT_EXCLUSIVE:
-          if(result > begin && result <= end) {
-            return result;
-          }
-          break;
-        case Interval::RIGHT_EXCLUSIVE:
-          if(result >= begin && result < end) {
-            return result;
-          }
-          break;
-        case Interval::OPEN:
-          if(result > begin && result < end) {
-            return result;
-          }
-          break;
+      auto result = round(std::move(value), granularity...);
+      if(is_after_begin(result, begin) && is_before_end(result, end)) {
+        return result;
       }
     }
   }
 
-  template<typename B, typename E, typename G>
-  typename Range<B, E, G>::Type Range<B, E, G>::calculate_random(
+  template<typename B, typename E, typename G, typename R>
+  bool Range<B, E, G, R>::is_after_begin(const Type& value,
+      const Type& begin) const {
+    if(static_cast<int>(m_interval) &
+        static_cast<int>(Interval::LEFT_EXCLUSIVE)) {
+      return value > begin;
+    }
+    return value >= begin;
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  bool Range<B, E, G, R>::is_before_end(const Type& value,
+      const Type& end) const {
+    if(static_cast<int>(m_interval) &
+        static_cast<int>(Interval::RIGHT_EXCLUSIVE)) {
+      return value < end;
+    }
+    return value <= end;
+  }
+
+  template<typename B, typename E, typename G, typename R>
+  typename Range<B, E, G, R>::Type Range<B, E, G, R>::calculate_random(
       const Type& begin, const Type& end) {
     auto random_fraction = m_distribution(m_engine);
     auto distance = static_cast<Type>(random_fraction * (end - begin));
@@ -178,8 +444,8 @@ namespace Rover {
     return value;
   }
 
-  template<typename B, typename E, typename G>
-  typename Range<B, E, G>::Type Range<B, E, G>::pick_random(
+  template<typename B, typename E, typename G, typename R>
+  typename Range<B, E, G, R>::Type Range<B, E, G, R>::pick_random(
       const Type& lhs, const Type& rhs) {
     auto random_fraction = m_distribution(m_engine);
     if(random_fraction < 0.5) {
@@ -189,18 +455,17 @@ namespace Rover {
     }
   }
 
-  template<typename B, typename E, typename G>
-  template<typename TypeFwd>
-  typename Range<B, E, G>::Type Range<B, E, G>::round(
-      Evaluator& evaluator, TypeFwd&& value) {
+  template<typename B, typename E, typename G, typename R>
+  template<typename TypeFwd, typename... GranularityType>
+  typename Range<B, E, G, R>::Type Range<B, E, G, R>::round(TypeFwd&& value,
+      const GranularityType&... granularity) {
     using namespace std;
-    if constexpr(std::is_same_v<G, void>) {
+    if constexpr(sizeof...(GranularityType) == 0) {
       return std::forward<TypeFwd>(value);
     } else {
-      auto granularity = evaluator.evaluate(m_granularity);
-      auto flr = static_cast<Type>(granularity * floor(value / granularity));
-      auto ceil = static_cast<Type>(granularity * (floor(value / granularity) +
-        1));
+      const auto& step = std::get<0>(std::tie(granularity...));
+      auto flr = static_cast<Type>(step * floor(value / step));
+      auto ceil = static_cast<Type>(step * (floor(value / step) + 1));
       if(abs(value - flr) <= abs(ceil - value)) {
         return flr;
       } else {
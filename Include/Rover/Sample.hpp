@@ -194,7 +194,7 @@ namespace Details {
     string_stream << argument;
     auto field = string_stream.str();
     if(std::find_if(field.begin(), field.end(), [](auto c) {
-         return c == ',' || c == '"' || c == '\n';
+         return c == ',' || c == '"' || c == '\n' || c == '\0';
        }) == field.end()) {
       stream << field;
       return;
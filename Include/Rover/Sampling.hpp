@@ -0,0 +1,328 @@
+#ifndef ROVER_SAMPLING_HPP
+#define ROVER_SAMPLING_HPP
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include "Rover/Range.hpp"
+
+namespace Rover {
+
+  //! The number of values drawn at once by the sampling kernels of the
+  //! continuous distributions.
+  inline constexpr auto SAMPLING_LANES = std::size_t(8);
+
+namespace Details {
+
+  //! A block of values processed by the sampling kernels.
+  using Lanes = std::array<double, SAMPLING_LANES>;
+
+  //! Draws a uniform double in [0, 1) with 53 bits of randomness.
+  template<typename Engine>
+  double draw_unit(Engine& engine) {
+    using Result = typename Engine::result_type;
+    constexpr auto SCALE = 0x1p-53;
+    if constexpr(Engine::min() == 0 &&
+        Engine::max() == std::numeric_limits<std::uint64_t>::max() &&
+        sizeof(Result) == sizeof(std::uint64_t)) {
+      return static_cast<double>(engine() >> 11) * SCALE;
+    } else if constexpr(Engine::min() == 0 &&
+        Engine::max() == std::numeric_limits<std::uint32_t>::max() &&
+        sizeof(Result) == sizeof(std::uint32_t)) {
+      auto high = static_cast<std::uint64_t>(engine());
+      auto low = static_cast<std::uint64_t>(engine());
+      return static_cast<double>((high << 21) | (low >> 11)) * SCALE;
+    } else {
+      return std::generate_canonical<double,
+        std::numeric_limits<double>::digits>(engine);
+    }
+  }
+
+  //! Fills a block with uniform values in [0, 1).
+  template<typename Engine>
+  void draw_uniform(Engine& engine, Lanes& lanes) {
+    for(auto& lane : lanes) {
+      lane = draw_unit(engine);
+    }
+  }
+
+  //! The layers of the ziggurat used to sample the standard normal
+  //! distribution.
+  struct NormalZiggurat {
+
+    //! The number of layers, a power of two.
+    static constexpr auto LAYERS = std::size_t(128);
+
+    //! The start of the tail.
+    static constexpr auto TAIL = 3.442619855899;
+
+    //! The area of every layer.
+    static constexpr auto AREA = 9.91256303526217e-3;
+
+    //! The right edge of every layer, from the base to the top.
+    std::array<double, LAYERS + 1> m_edges;
+
+    //! The ratio of the right edge of the layer above to the right edge of
+    //! every layer, below which a point lies under the density.
+    std::array<double, LAYERS> m_ratios;
+
+    NormalZiggurat() {
+      auto density = std::exp(-0.5 * TAIL * TAIL);
+      m_edges[0] = AREA / density;
+      m_edges[1] = TAIL;
+      m_edges[LAYERS] = 0;
+      for(auto i = std::size_t(2); i != LAYERS; ++i) {
+        m_edges[i] = std::sqrt(-2 * std::log(AREA / m_edges[i - 1] +
+          density));
+        density = std::exp(-0.5 * m_edges[i] * m_edges[i]);
+      }
+      for(auto i = std::size_t(0); i != LAYERS; ++i) {
+        m_ratios[i] = m_edges[i + 1] / m_edges[i];
+      }
+    }
+
+    static const NormalZiggurat& get() {
+      static const auto ziggurat = NormalZiggurat();
+      return ziggurat;
+    }
+  };
+
+  //! Draws 64 random bits.
+  template<typename Engine>
+  std::uint64_t draw_bits(Engine& engine) {
+    if constexpr(Engine::min() == 0 &&
+        Engine::max() == std::numeric_limits<std::uint64_t>::max()) {
+      return static_cast<std::uint64_t>(engine());
+    } else if constexpr(Engine::min() == 0 &&
+        Engine::max() == std::numeric_limits<std::uint32_t>::max()) {
+      auto high = static_cast<std::uint64_t>(engine());
+      return (high << 32) | static_cast<std::uint64_t>(engine());
+    } else {
+      auto high = static_cast<std::uint64_t>(std::ldexp(draw_unit(engine),
+        32));
+      return (high << 32) | static_cast<std::uint64_t>(std::ldexp(
+        draw_unit(engine), 32));
+    }
+  }
+
+  //! Draws a standard normal value with the ziggurat method once the fast
+  //! path was rejected, using the layer's wedge or the tail.
+  template<typename Engine>
+  double draw_normal_slow(Engine& engine, const NormalZiggurat& ziggurat,
+      std::size_t layer, double fraction) {
+    while(true) {
+      if(layer == 0) {
+        auto x = 0.;
+        auto y = 0.;
+        do {
+          x = std::log1p(-draw_unit(engine)) / NormalZiggurat::TAIL;
+          y = std::log1p(-draw_unit(engine));
+        } while(-2 * y < x * x);
+        return fraction < 0 ? x - NormalZiggurat::TAIL :
+          NormalZiggurat::TAIL - x;
+      }
+      auto x = fraction * ziggurat.m_edges[layer];
+      auto inner = std::exp(-0.5 * (ziggurat.m_edges[layer] *
+        ziggurat.m_edges[layer] - x * x));
+      auto outer = std::exp(-0.5 * (ziggurat.m_edges[layer + 1] *
+        ziggurat.m_edges[layer + 1] - x * x));
+      if(outer + draw_unit(engine) * (inner - outer) < 1) {
+        return x;
+      }
+      auto bits = draw_bits(engine);
+      layer = bits & (NormalZiggurat::LAYERS - 1);
+      fraction = static_cast<double>(bits >> 11) * 0x1p-52 - 1;
+      if(std::abs(fraction) < ziggurat.m_ratios[layer]) {
+        return fraction * ziggurat.m_edges[layer];
+      }
+    }
+  }
+
+  //! Draws a standard normal value using the ziggurat method.
+  template<typename Engine>
+  double draw_normal(Engine& engine) {
+    auto& ziggurat = NormalZiggurat::get();
+    auto bits = draw_bits(engine);
+    auto layer = static_cast<std::size_t>(bits &
+      (NormalZiggurat::LAYERS - 1));
+    auto fraction = static_cast<double>(bits >> 11) * 0x1p-52 - 1;
+    if(std::abs(fraction) < ziggurat.m_ratios[layer]) {
+      return fraction * ziggurat.m_edges[layer];
+    }
+    return draw_normal_slow(engine, ziggurat, layer, fraction);
+  }
+
+  //! Fills a block with standard normal values using the ziggurat method.
+  /*!
+    \details Every lane takes its layer from the low bits of a 64-bit draw
+             and its position within the layer from the high bits, and only
+             the rare lanes falling outside of the rectangle under the
+             density are resampled one at a time.
+  */
+  template<typename Engine>
+  void draw_normal(Engine& engine, Lanes& lanes) {
+    auto& ziggurat = NormalZiggurat::get();
+    std::size_t layers[SAMPLING_LANES];
+    double fractions[SAMPLING_LANES];
+    for(auto i = std::size_t(0); i != SAMPLING_LANES; ++i) {
+      auto bits = draw_bits(engine);
+      layers[i] = bits & (NormalZiggurat::LAYERS - 1);
+      fractions[i] = static_cast<double>(bits >> 11) * 0x1p-52 - 1;
+    }
+    auto rejections = 0;
+    for(auto i = std::size_t(0); i != SAMPLING_LANES; ++i) {
+      rejections += std::abs(fractions[i]) >= ziggurat.m_ratios[layers[i]];
+      lanes[i] = fractions[i] * ziggurat.m_edges[layers[i]];
+    }
+    if(rejections != 0) {
+      for(auto i = std::size_t(0); i != SAMPLING_LANES; ++i) {
+        if(std::abs(fractions[i]) >= ziggurat.m_ratios[layers[i]]) {
+          lanes[i] = draw_normal_slow(engine, ziggurat, layers[i],
+            fractions[i]);
+        }
+      }
+    }
+  }
+
+  //! Fills a block with exponential values of rate 1.
+  template<typename Engine>
+  void draw_exponential(Engine& engine, Lanes& lanes) {
+    draw_uniform(engine, lanes);
+    for(auto& lane : lanes) {
+      lane = -std::log1p(-lane);
+    }
+  }
+
+  //! Returns the cumulative distribution function of the standard normal
+  //! distribution.
+  inline double normal_cdf(double value) {
+    return 0.5 * std::erfc(-value * 0.7071067811865476);
+  }
+
+  //! Returns the quantile function of the standard normal distribution.
+  /*!
+    \param probability A probability in [0, 1].
+    \details Uses Acklam's rational approximation refined by one step of
+             Halley's method, accurate to about 1e-15.
+  */
+  inline double normal_quantile(double probability) {
+    constexpr double A[] = {-3.969683028665376e+01, 2.209460984245205e+02,
+      -2.759285104469687e+02, 1.383577518672690e+02, -3.066479806614716e+01,
+      2.506628277459239e+00};
+    constexpr double B[] = {-5.447609879822406e+01, 1.615858368580409e+02,
+      -1.556989798598866e+02, 6.680131188771972e+01, -1.328068155288572e+01};
+    constexpr double C[] = {-7.784894002430293e-03, -3.223964580411365e-01,
+      -2.400758277161838e+00, -2.549732539343734e+00, 4.374664141464968e+00,
+      2.938163982698783e+00};
+    constexpr double D[] = {7.784695709041462e-03, 3.224671290700398e-01,
+      2.445134137142996e+00, 3.754408661907416e+00};
+    constexpr auto LOW = 0.02425;
+    if(probability <= 0) {
+      return -std::numeric_limits<double>::infinity();
+    } else if(probability >= 1) {
+      return std::numeric_limits<double>::infinity();
+    }
+    auto tail = [&](double q) {
+      return (((((C[0] * q + C[1]) * q + C[2]) * q + C[3]) * q + C[4]) * q +
+        C[5]) / ((((D[0] * q + D[1]) * q + D[2]) * q + D[3]) * q + 1);
+    };
+    auto value = [&] {
+      if(probability < LOW) {
+        return tail(std::sqrt(-2 * std::log(probability)));
+      } else if(probability > 1 - LOW) {
+        return -tail(std::sqrt(-2 * std::log1p(-probability)));
+      }
+      auto q = probability - 0.5;
+      auto r = q * q;
+      return (((((A[0] * r + A[1]) * r + A[2]) * r + A[3]) * r + A[4]) * r +
+        A[5]) * q / (((((B[0] * r + B[1]) * r + B[2]) * r + B[3]) * r +
+        B[4]) * r + 1);
+    }();
+    auto error = normal_cdf(value) - probability;
+    auto step = error * 2.5066282746310002 * std::exp(0.5 * value * value);
+    return value - step / (1 + 0.5 * value * step);
+  }
+
+  //! Tests whether a value lies within an interval.
+  template<typename T>
+  bool is_within(const T& value, const T& begin, const T& end,
+      Interval interval) {
+    auto is_after_begin = static_cast<int>(interval) &
+      static_cast<int>(Interval::LEFT_EXCLUSIVE) ? value > begin :
+      value >= begin;
+    auto is_before_end = static_cast<int>(interval) &
+      static_cast<int>(Interval::RIGHT_EXCLUSIVE) ? value < end :
+      value <= end;
+    return is_after_begin && is_before_end;
+  }
+
+  //! Tests whether an interval contains a value representable by a
+  //! generator, i.e. a multiple of its granularity if it has one, or an
+  //! integer if its type is integral.
+  template<typename T, typename... Granularity>
+  bool has_admissible_value(const T& begin, const T& end, Interval interval,
+      const Granularity&... granularity) {
+    if constexpr(sizeof...(Granularity) != 0) {
+      auto step = static_cast<double>(std::get<0>(std::tie(granularity...)));
+      auto index = std::ceil(static_cast<double>(begin) / step);
+      for(auto offset : { -1., 0., 1. }) {
+        if(is_within(static_cast<T>(step * (index + offset)), begin, end,
+            interval)) {
+          return true;
+        }
+      }
+      return false;
+    } else if constexpr(std::is_integral_v<T>) {
+      return is_within(begin, begin, end, interval) ||
+        (begin < end && is_within(static_cast<T>(begin + 1), begin, end,
+        interval));
+    } else {
+      return is_within(begin, begin, end, interval) ||
+        is_within(std::nextafter(begin, end), begin, end, interval);
+    }
+  }
+
+  //! Rounds a continuous draw to the nearest value representable by a
+  //! generator, i.e. to a multiple of its granularity if it has one, or to
+  //! the nearest integer if its type is integral.
+  template<typename T, typename... Granularity>
+  T snap(double value, const Granularity&... granularity) {
+    if constexpr(sizeof...(Granularity) != 0) {
+      auto step = static_cast<double>(std::get<0>(std::tie(granularity...)));
+      return static_cast<T>(step * std::round(value / step));
+    } else if constexpr(std::is_integral_v<T>) {
+      return static_cast<T>(std::llround(value));
+    } else {
+      return static_cast<T>(value);
+    }
+  }
+
+  //! Moves a snapped value one step inwards if it falls outside of its
+  //! interval, used to make the quantile of a bounded distribution
+  //! admissible.
+  template<typename T, typename... Granularity>
+  T admit(const T& value, const T& begin, const T& end, Interval interval,
+      const Granularity&... granularity) {
+    if(is_within(value, begin, end, interval)) {
+      return value;
+    }
+    auto& target = value <= begin ? end : begin;
+    if constexpr(sizeof...(Granularity) != 0) {
+      auto step = std::get<0>(std::tie(granularity...));
+      return static_cast<T>(target > value ? value + step : value - step);
+    } else if constexpr(std::is_integral_v<T>) {
+      return static_cast<T>(target > value ? value + 1 : value - 1);
+    } else {
+      return std::nextafter(value, target);
+    }
+  }
+}
+}
+
+#endif
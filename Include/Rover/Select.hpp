@@ -1,10 +1,13 @@
 #ifndef ROVER_SELECT_HPP
 #define ROVER_SELECT_HPP
+#include <cstdint>
+#include <stdexcept>
 #include <type_traits>
 #include <vector>
 #include "Rover/Autobox.hpp"
 #include "Rover/Evaluator.hpp"
 #include "Rover/Range.hpp"
+#include "Rover/WeightedIndex.hpp"
 
 namespace Rover {
 namespace Details {
@@ -54,6 +57,16 @@ namespace Details {
   template<typename T>
   inline constexpr bool is_map_v = is_map<T>::value;
 
+  template<typename S>
+  void check_selector(const S&, std::size_t) {}
+
+  template<typename R>
+  void check_selector(const WeightedIndex<R>& selector, std::size_t size) {
+    if(selector.size() != size) {
+      throw std::invalid_argument("Weights do not match the container.");
+    }
+  }
+
   template<typename T, typename = std::void_t<>>
   struct is_set : std::false_type {};
 
@@ -105,6 +118,8 @@ namespace Details {
         \param container Array-like container defining value_type, begin,
                          and integer indexing.
         \param selector Generator evaluating to an index in the array.
+        \throw std::invalid_argument If the selector is a WeightedIndex
+               whose number of weights differs from the number of elements.
       */
       Select(Container container, Selector selector);
 
@@ -114,6 +129,20 @@ namespace Details {
       */
       Type generate(Evaluator& evaluator);
 
+      //! Returns the number of elements.
+      std::uint64_t size() const;
+
+      //! Evaluates the element at an index, used by generators enumerating
+      //! the elements.
+      /*!
+        \param evaluator The evaluator keeping track of the current session.
+        \param index The index of the element, less than size.
+      */
+      Type at(Evaluator& evaluator, std::uint64_t index);
+
+      //! Returns the selector.
+      Selector& get_selector();
+
     private:
       Container m_container;
       Selector m_selector;
@@ -152,6 +181,8 @@ namespace Details {
       /*!
         \param container Set-like container defining value_type, begin, and end.
         \param selector Generator evaluating to an index in the array.
+        \throw std::invalid_argument If the selector is a WeightedIndex
+               whose number of weights differs from the number of elements.
       */
       Select(const Container& container, Selector selector);
 
@@ -161,6 +192,20 @@ namespace Details {
       */
       Type generate(Evaluator& evaluator);
 
+      //! Returns the number of elements.
+      std::uint64_t size() const;
+
+      //! Evaluates the element at an index, used by generators enumerating
+      //! the elements.
+      /*!
+        \param evaluator The evaluator keeping track of the current session.
+        \param index The index of the element, less than size.
+      */
+      Type at(Evaluator& evaluator, std::uint64_t index);
+
+      //! Returns the selector.
+      Selector& get_selector();
+
     private:
       std::vector<Element> m_container;
       Selector m_selector;
@@ -199,6 +244,8 @@ namespace Details {
       /*!
         \param container Map-like container defining mapped_type, begin, and end.
         \param selector Generator evaluating to an index in the array.
+        \throw std::invalid_argument If the selector is a WeightedIndex
+               whose number of weights differs from the number of elements.
       */
       Select(const Container& container, Selector selector);
 
@@ -208,6 +255,20 @@ namespace Details {
       */
       Type generate(Evaluator& evaluator);
 
+      //! Returns the number of elements.
+      std::uint64_t size() const;
+
+      //! Evaluates the element at an index, used by generators enumerating
+      //! the elements.
+      /*!
+        \param evaluator The evaluator keeping track of the current session.
+        \param index The index of the element, less than size.
+      */
+      Type at(Evaluator& evaluator, std::uint64_t index);
+
+      //! Returns the selector.
+      Selector& get_selector();
+
     private:
       std::vector<Element> m_container;
       Selector m_selector;
@@ -219,6 +280,14 @@ namespace Details {
   template<typename C, typename S>
   Select(C, S) -> Select<C, S>;
 
+  //! Selects the elements of a container with probabilities proportional to
+  //! their weights, which can be updated through get_selector().
+  /*!
+    \tparam C The type of the container.
+  */
+  template<typename C>
+  using WeightedSelect = Select<C, WeightedIndex<>>;
+
   template<typename C, typename S>
   Select<C, S, std::enable_if_t<Details::is_array_v<C>>>::Select(
       Container container)
@@ -228,8 +297,29 @@ namespace Details {
   template<typename C, typename S>
   Select<C, S, std::enable_if_t<Details::is_array_v<C>>>::Select(
       Container container, Selector selector)
-    : m_container(std::move(container)),
-      m_selector(std::move(selector)) {}
+      : m_container(std::move(container)),
+        m_selector(std::move(selector)) {
+    Details::check_selector(m_selector, m_container.size());
+  }
+
+  template<typename C, typename S>
+  typename Select<C, S, std::enable_if_t<Details::is_array_v<C>>>::Selector&
+      Select<C, S, std::enable_if_t<Details::is_array_v<C>>>::get_selector() {
+    return m_selector;
+  }
+
+  template<typename C, typename S>
+  std::uint64_t Select<C, S, std::enable_if_t<Details::is_array_v<C>>>::size()
+      const {
+    return m_container.size();
+  }
+
+  template<typename C, typename S>
+  typename Select<C, S, std::enable_if_t<Details::is_array_v<C>>>::Type
+      Select<C, S, std::enable_if_t<Details::is_array_v<C>>>::at(
+      Evaluator& evaluator, std::uint64_t index) {
+    return evaluator.evaluate(make_autobox(m_container[index]));
+  }
 
   template<typename C, typename S>
   typename Select<C, S, std::enable_if_t<Details::is_array_v<C>>>::Type
@@ -257,6 +347,26 @@ namespace Details {
     for(auto generator : container) {
       m_container.push_back(std::move(generator));
     }
+    Details::check_selector(m_selector, m_container.size());
+  }
+
+  template<typename C, typename S>
+  typename Select<C, S, std::enable_if_t<Details::is_set_v<C>>>::Selector&
+      Select<C, S, std::enable_if_t<Details::is_set_v<C>>>::get_selector() {
+    return m_selector;
+  }
+
+  template<typename C, typename S>
+  std::uint64_t Select<C, S, std::enable_if_t<Details::is_set_v<C>>>::size()
+      const {
+    return m_container.size();
+  }
+
+  template<typename C, typename S>
+  typename Select<C, S, std::enable_if_t<Details::is_set_v<C>>>::Type
+      Select<C, S, std::enable_if_t<Details::is_set_v<C>>>::at(
+      Evaluator& evaluator, std::uint64_t index) {
+    return evaluator.evaluate(m_container[index]);
   }
 
   template<typename C, typename S>
@@ -285,6 +395,26 @@ namespace Details {
     for(auto& p : container) {
       m_container.push_back(p.second);
     }
+    Details::check_selector(m_selector, m_container.size());
+  }
+
+  template<typename C, typename S>
+  typename Select<C, S, std::enable_if_t<Details::is_map_v<C>>>::Selector&
+      Select<C, S, std::enable_if_t<Details::is_map_v<C>>>::get_selector() {
+    return m_selector;
+  }
+
+  template<typename C, typename S>
+  std::uint64_t Select<C, S, std::enable_if_t<Details::is_map_v<C>>>::size()
+      const {
+    return m_container.size();
+  }
+
+  template<typename C, typename S>
+  typename Select<C, S, std::enable_if_t<Details::is_map_v<C>>>::Type
+      Select<C, S, std::enable_if_t<Details::is_map_v<C>>>::at(
+      Evaluator& evaluator, std::uint64_t index) {
+    return evaluator.evaluate(m_container[index]);
   }
 
   template<typename C, typename S>
@@ -0,0 +1,347 @@
+#ifndef ROVER_TRIAL_RUNNER_HPP
+#define ROVER_TRIAL_RUNNER_HPP
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Rover/Evaluator.hpp"
+#include "Rover/ListTrial.hpp"
+#include "Rover/ObjectiveCache.hpp"
+#include "Rover/Random.hpp"
+#include "Rover/Sample.hpp"
+
+namespace Rover {
+namespace Details {
+  template<typename F, typename G>
+  struct runner_sample;
+
+  template<typename F, typename... G>
+  struct runner_sample<F, std::tuple<G...>> {
+    using type = Sample<std::decay_t<std::invoke_result_t<F&,
+      const typename G::Type&...>>, typename G::Type...>;
+  };
+
+  template<typename F, typename G>
+  using runner_sample_t = typename runner_sample<F, G>::type;
+
+  template<typename T, typename = void>
+  struct has_seek : std::false_type {};
+
+  template<typename T>
+  struct has_seek<T, std::void_t<decltype(std::declval<T&>().seek(
+    std::declval<std::uint64_t>()))>> : std::true_type {};
+
+  template<typename Generator>
+  void seek_generator(Generator& generator, std::uint64_t index) {
+    if constexpr(has_seek<Generator>::value) {
+      generator.seek(index);
+    }
+  }
+}
+
+  //! The largest number of chunks a run is split into.
+  inline constexpr auto RUNNER_CHUNK_COUNT = std::size_t(256);
+
+  //! Evaluates a function over arguments produced by generators using a pool
+  //! of worker threads.
+  /*!
+    \tparam B The type of the callable building the generators.
+    \tparam F The type of the function to evaluate.
+    \details The generators are built anew for each chunk of a run. Those
+             providing seek(std::uint64_t), such as Halton, Grid and
+             LatinHypercube, are then moved to the index of the chunk's
+             first evaluation within the run, so that ordered designs
+             continue across chunks instead of restarting in each of them.
+             Designs whose order depends on their seed, such as a
+             LatinHypercube, should be built within a SeedScope of their own
+             so that every chunk follows the same order.
+  */
+  template<typename B, typename F>
+  class TrialRunner {
+    public:
+
+      //! The type of the callable building the generators.
+      using Builder = B;
+
+      //! The tuple of generators returned by the builder.
+      using Generators = std::invoke_result_t<Builder&>;
+
+      //! The type of the function to evaluate.
+      using Function = F;
+
+      //! The type of the samples produced.
+      using Sample = Details::runner_sample_t<Function, Generators>;
+
+      //! The default type of trial storing the samples.
+      using Trial = ListTrial<Sample>;
+
+      //! The type of cache storing the results by arguments.
+      using Cache = ObjectiveCache<typename Sample::Arguments,
+        typename Sample::Result>;
+
+      //! Constructs a TrialRunner using one worker per hardware thread.
+      /*!
+        \param builder Callable returning a tuple of generators. It is called
+                       for each chunk of evaluations within a SeedScope, so
+                       that every worker owns its own replica of the
+                       generators and every chunk draws from its own stream.
+        \param function The function to evaluate, which is called
+                        concurrently by the workers.
+      */
+      template<typename BuilderFwd, typename FunctionFwd>
+      TrialRunner(BuilderFwd&& builder, FunctionFwd&& function);
+
+      //! Constructs a TrialRunner.
+      /*!
+        \param builder Callable returning a tuple of generators. It is called
+                       for each chunk of evaluations within a SeedScope, so
+                       that every worker owns its own replica of the
+                       generators and every chunk draws from its own stream.
+        \param function The function to evaluate, which is called
+                        concurrently by the workers.
+        \param concurrency The number of workers.
+      */
+      template<typename BuilderFwd, typename FunctionFwd>
+      TrialRunner(BuilderFwd&& builder, FunctionFwd&& function,
+        std::size_t concurrency);
+
+      //! Returns the number of workers.
+      std::size_t concurrency() const;
+
+      //! Makes the runs reproducible.
+      /*!
+        \param seed The seed from which the seed of every run is derived.
+        \details Once seeded, the samples produced by a sequence of runs
+                 only depend on the seed and on the counts, regardless of the
+                 concurrency, provided the generators only draw from engines
+                 seeded with next_seed.
+      */
+      void seed(std::uint64_t seed);
+
+      //! Caches the results of the function, so that repeated arguments are
+      //! only evaluated once.
+      /*!
+        \param capacity The largest number of results stored.
+        \param is_recording_hits Whether arguments found in the cache still
+                                 produce a sample, otherwise they are
+                                 skipped and a run produces fewer samples
+                                 than its count.
+        \details The cache persists across runs and replaces any previous
+                 cache. The arguments must satisfy is_cacheable_v, runners
+                 whose arguments do not are never cached.
+      */
+      void enable_cache(std::size_t capacity, bool is_recording_hits = true);
+
+      //! Stops caching the results of the function.
+      void disable_cache();
+
+      //! Returns the cache, or nullptr if results are not cached.
+      const Cache* get_cache() const;
+
+      //! Evaluates the function and inserts the samples into a trial.
+      /*!
+        \param count The number of evaluations.
+        \param trial The trial receiving the samples.
+        \details The evaluations are split into chunks that workers claim as
+                 they become idle, and the samples are inserted in chunk
+                 order once every worker is done. If an evaluation throws,
+                 the remaining chunks are abandoned, the trial is left
+                 unchanged and the exception is rethrown.
+      */
+      template<typename T>
+      void run(std::size_t count, T& trial);
+
+      //! Evaluates the function and returns the samples in a new trial.
+      /*!
+        \param count The number of evaluations.
+      */
+      Trial run(std::size_t count);
+
+    private:
+      Builder m_builder;
+      Function m_function;
+      std::size_t m_concurrency;
+      std::optional<std::uint64_t> m_seed;
+      std::uint64_t m_runs;
+      std::mutex m_builder_mutex;
+      std::unique_ptr<Cache> m_cache;
+      bool m_is_recording_hits;
+
+      void evaluate(Generators& generators, Evaluator& evaluator,
+        std::vector<Sample>& samples);
+  };
+
+  template<typename BuilderFwd, typename FunctionFwd>
+  TrialRunner(BuilderFwd&&, FunctionFwd&&) -> TrialRunner<
+    std::decay_t<BuilderFwd>, std::decay_t<FunctionFwd>>;
+
+  template<typename BuilderFwd, typename FunctionFwd>
+  TrialRunner(BuilderFwd&&, FunctionFwd&&, std::size_t) -> TrialRunner<
+    std::decay_t<BuilderFwd>, std::decay_t<FunctionFwd>>;
+
+  template<typename B, typename F>
+  template<typename BuilderFwd, typename FunctionFwd>
+  TrialRunner<B, F>::TrialRunner(BuilderFwd&& builder, FunctionFwd&& function)
+    : TrialRunner(std::forward<BuilderFwd>(builder),
+        std::forward<FunctionFwd>(function), std::max(1U,
+        std::thread::hardware_concurrency())) {}
+
+  template<typename B, typename F>
+  template<typename BuilderFwd, typename FunctionFwd>
+  TrialRunner<B, F>::TrialRunner(BuilderFwd&& builder, FunctionFwd&& function,
+    std::size_t concurrency)
+    : m_builder(std::forward<BuilderFwd>(builder)),
+      m_function(std::forward<FunctionFwd>(function)),
+      m_concurrency(std::max(std::size_t(1), concurrency)),
+      m_runs(0),
+      m_is_recording_hits(true) {}
+
+  template<typename B, typename F>
+  std::size_t TrialRunner<B, F>::concurrency() const {
+    return m_concurrency;
+  }
+
+  template<typename B, typename F>
+  void TrialRunner<B, F>::seed(std::uint64_t seed) {
+    m_seed = seed;
+    m_runs = 0;
+  }
+
+  template<typename B, typename F>
+  void TrialRunner<B, F>::enable_cache(std::size_t capacity,
+      bool is_recording_hits) {
+    static_assert(is_cacheable_v<typename Sample::Arguments>,
+      "Caching requires arguments with std::hash and operator ==.");
+    m_cache = std::make_unique<Cache>(capacity);
+    m_is_recording_hits = is_recording_hits;
+  }
+
+  template<typename B, typename F>
+  void TrialRunner<B, F>::disable_cache() {
+    m_cache = nullptr;
+  }
+
+  template<typename B, typename F>
+  const typename TrialRunner<B, F>::Cache* TrialRunner<B, F>::get_cache()
+      const {
+    return m_cache.get();
+  }
+
+  template<typename B, typename F>
+  template<typename T>
+  void TrialRunner<B, F>::run(std::size_t count, T& trial) {
+    auto run_seed = [&] {
+      if(m_seed) {
+        return derive_seed(*m_seed, m_runs++);
+      }
+      return next_seed();
+    }();
+    auto chunk_size = std::max(std::size_t(1),
+      (count + RUNNER_CHUNK_COUNT - 1) / RUNNER_CHUNK_COUNT);
+    auto chunks = std::vector<std::vector<Sample>>(
+      (count + chunk_size - 1) / chunk_size);
+    auto next_chunk = std::atomic<std::size_t>(0);
+    auto is_failed = std::atomic<bool>(false);
+    auto exception = std::exception_ptr();
+    auto exception_mutex = std::mutex();
+    auto work = [&] {
+      try {
+        auto evaluator = Evaluator();
+        while(!is_failed) {
+          auto chunk = next_chunk++;
+          if(chunk >= chunks.size()) {
+            break;
+          }
+          auto generators = [&] {
+            auto scope = SeedScope(derive_seed(run_seed, chunk));
+            auto lock = std::lock_guard(m_builder_mutex);
+            return std::invoke(m_builder);
+          }();
+          auto& samples = chunks[chunk];
+          auto begin = chunk * chunk_size;
+          auto end = std::min(count, begin + chunk_size);
+          std::apply([&](auto&... generators) {
+            (Details::seek_generator(generators, begin), ...);
+          }, generators);
+          samples.reserve(end - begin);
+          for(auto i = begin; i != end && !is_failed; ++i) {
+            evaluate(generators, evaluator, samples);
+          }
+        }
+      } catch(...) {
+        auto lock = std::lock_guard(exception_mutex);
+        if(!exception) {
+          exception = std::current_exception();
+        }
+        is_failed = true;
+      }
+    };
+    auto workers = std::vector<std::thread>();
+    auto worker_count = std::min(m_concurrency, chunks.size());
+    for(auto i = std::size_t(1); i < worker_count; ++i) {
+      workers.emplace_back(work);
+    }
+    work();
+    for(auto& worker : workers) {
+      worker.join();
+    }
+    if(exception) {
+      std::rethrow_exception(exception);
+    }
+    for(auto& samples : chunks) {
+      for(auto& sample : samples) {
+        trial.insert(std::move(sample));
+      }
+    }
+  }
+
+  template<typename B, typename F>
+  typename TrialRunner<B, F>::Trial TrialRunner<B, F>::run(
+      std::size_t count) {
+    auto trial = Trial();
+    trial.reserve(count);
+    run(count, trial);
+    return trial;
+  }
+
+  template<typename B, typename F>
+  void TrialRunner<B, F>::evaluate(Generators& generators,
+      Evaluator& evaluator, std::vector<Sample>& samples) {
+    evaluator.reset();
+    auto arguments = std::apply([&](auto&... generators) {
+      return typename Sample::Arguments(evaluator.evaluate(generators)...);
+    }, generators);
+    auto invoke = [&](const auto&... arguments) {
+      return std::invoke(m_function, arguments...);
+    };
+    if constexpr(is_cacheable_v<typename Sample::Arguments>) {
+      if(m_cache) {
+        if(auto result = m_cache->find(arguments)) {
+          if(m_is_recording_hits) {
+            samples.push_back(
+              Sample{std::move(*result), std::move(arguments)});
+          }
+        } else {
+          auto computed = std::apply(invoke, arguments);
+          m_cache->insert(arguments, computed);
+          samples.push_back(
+            Sample{std::move(computed), std::move(arguments)});
+        }
+        return;
+      }
+    }
+    auto result = std::apply(invoke, arguments);
+    samples.push_back(Sample{std::move(result), std::move(arguments)});
+  }
+}
+
+#endif
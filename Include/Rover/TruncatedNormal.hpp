@@ -0,0 +1,387 @@
+#ifndef ROVER_TRUNCATED_NORMAL_HPP
+#define ROVER_TRUNCATED_NORMAL_HPP
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Rover/Autobox.hpp"
+#include "Rover/Batch.hpp"
+#include "Rover/Evaluator.hpp"
+#include "Rover/Random.hpp"
+#include "Rover/Range.hpp"
+#include "Rover/Sampling.hpp"
+
+namespace Rover {
+namespace Details {
+
+  /** Inverts the cumulative distribution function of a normal distribution
+      restricted to [begin, end]. */
+  class TruncatedNormalQuantile {
+    public:
+      TruncatedNormalQuantile(double mean, double deviation, double begin,
+          double end)
+          : m_mean(mean),
+            m_deviation(deviation),
+            m_begin(begin),
+            m_end(end) {
+        auto low = (begin - mean) / deviation;
+        auto high = (end - mean) / deviation;
+
+        // Quantiles are taken in the lower tail, where the cumulative
+        // distribution function keeps its precision.
+        m_is_mirrored = low > 0;
+        if(m_is_mirrored) {
+          std::swap(low, high);
+          low = -low;
+          high = -high;
+        }
+        m_low = low;
+        m_high = high;
+        m_low_probability = normal_cdf(low);
+        m_mass = normal_cdf(high) - m_low_probability;
+      }
+
+      double operator ()(double fraction) const {
+        auto value = [&] {
+          if(m_mass > 0) {
+            return normal_quantile(m_low_probability + fraction * m_mass);
+          }
+          return m_low + fraction * (m_high - m_low);
+        }();
+        if(m_is_mirrored) {
+          value = -value;
+        }
+        return std::clamp(m_mean + m_deviation * value, m_begin, m_end);
+      }
+
+    private:
+      double m_mean;
+      double m_deviation;
+      double m_begin;
+      double m_end;
+      double m_low;
+      double m_high;
+      double m_low_probability;
+      double m_mass;
+      bool m_is_mirrored;
+  };
+}
+
+  //! Generates an argument from a normal distribution restricted to a range
+  //! of values, all determined by sub-generators.
+  /*!
+    \tparam M The type of generator evaluating to the mean.
+    \tparam D The type of generator evaluating to the standard deviation.
+    \tparam B The type of generator evaluating to the beginning of the range.
+    \tparam E The type of generator evaluating to the end of the range.
+    \tparam G The type of generator used to determine the granularity of the
+              interval.
+    \tparam R The type of random engine.
+    \details Values are drawn over [begin, end] by inverting the cumulative
+             distribution function, so truncations far in the tails need no
+             rejection, and the function is only rebuilt when the parameters
+             change. They are then rounded to the nearest multiple of the
+             granularity, or to the nearest integer if the range is integral,
+             and values outside of the interval are redrawn. As for a Range,
+             if no such value lies within the interval, the beginning is
+             produced, rounded.
+  */
+  template<typename M, typename D, typename B, typename E, typename G = void,
+    typename R = DefaultEngine>
+  class TruncatedNormal {
+    public:
+
+      //! The type of generator evaluating to the mean.
+      using Mean = autobox_t<M>;
+
+      //! The type of generator evaluating to the standard deviation.
+      using Deviation = autobox_t<D>;
+
+      //! The type of generator evaluating to the beginning of the range.
+      using Begin = autobox_t<B>;
+
+      //! The type of generator evaluating to the end of the range.
+      using End = autobox_t<E>;
+
+      //! The type used to determine the granularity of the interval.
+      using Granularity = autobox_t<G>;
+
+      //! The type of random engine.
+      using Engine = R;
+
+      using Type = std::common_type_t<typename Begin::Type, typename End::Type>;
+
+      //! Constructs a TruncatedNormal.
+      /*!
+        \param mean The generator evaluating to the mean.
+        \param deviation The generator evaluating to the standard deviation.
+        \param begin The generator evaluating to the beginning of the range.
+        \param end The generator evaluating to the end of the range.
+        \param interval The type of interval.
+        \details The engine is seeded with next_seed.
+        \warning begin and end must define a valid non-empty interval. No check
+                 is made if an open interval is empty, which will result in an
+                 infinite loop in generate.
+      */
+      template<typename MeanFwd, typename DeviationFwd, typename BeginFwd,
+        typename EndFwd>
+      TruncatedNormal(MeanFwd&& mean, DeviationFwd&& deviation,
+        BeginFwd&& begin, EndFwd&& end, Interval interval = Interval::CLOSED);
+
+      //! Constructs a TruncatedNormal.
+      /*!
+        \param mean The generator evaluating to the mean.
+        \param deviation The generator evaluating to the standard deviation.
+        \param begin The generator evaluating to the beginning of the range.
+        \param end The generator evaluating to the end of the range.
+        \param granularity The granularity of the range.
+        \param interval The type of interval.
+        \details The engine is seeded with next_seed.
+        \warning begin and end must define a valid non-empty interval. No check
+                 is made if an open interval is empty, which will result in an
+                 infinite loop in generate.
+      */
+      template<typename MeanFwd, typename DeviationFwd, typename BeginFwd,
+        typename EndFwd, typename GranularityFwd>
+      TruncatedNormal(MeanFwd&& mean, DeviationFwd&& deviation,
+        BeginFwd&& begin, EndFwd&& end, GranularityFwd&& granularity,
+        Interval interval = Interval::CLOSED);
+
+      Type generate(Evaluator& evaluator);
+
+      //! Produces independent values in bulk.
+      /*!
+        \param count The number of values to produce.
+        \param out The output iterator receiving the values.
+        \return The output iterator past the last value written.
+      */
+      template<typename OutputIterator>
+      OutputIterator generate_batch(std::size_t count, OutputIterator out);
+
+      //! Maps a fraction to the value of the distribution at that quantile,
+      //! used by quasi-random generators.
+      /*!
+        \param evaluator The evaluator keeping track of the current session.
+        \param fraction A number in [0, 1).
+      */
+      Type transform(Evaluator& evaluator, double fraction);
+
+      //! Returns the random engine.
+      Engine& get_engine();
+
+    private:
+      using GranularityPlaceholder = std::conditional_t<std::is_same_v<
+        Granularity, void>, char, Granularity>;
+      using GranularityColumn = std::conditional_t<std::is_same_v<
+        Granularity, void>, std::tuple<>, Details::BatchColumn<Granularity>>;
+      Mean m_mean;
+      Deviation m_deviation;
+      Begin m_begin;
+      End m_end;
+      GranularityPlaceholder m_granularity;
+      Interval m_interval;
+      Engine m_engine;
+      std::tuple<double, double, double, double> m_parameters;
+      Details::TruncatedNormalQuantile m_quantile;
+
+      const Details::TruncatedNormalQuantile& get_quantile(double mean,
+        double deviation, double begin, double end);
+      template<typename... GranularityType>
+      Type draw(double fraction, const Details::TruncatedNormalQuantile&
+        quantile, const Type& begin, const Type& end,
+        const GranularityType&... granularity);
+  };
+
+  template<typename MeanFwd, typename DeviationFwd, typename BeginFwd,
+    typename EndFwd>
+  TruncatedNormal(MeanFwd&&, DeviationFwd&&, BeginFwd&&, EndFwd&&,
+    Interval = Interval::CLOSED) -> TruncatedNormal<std::decay_t<MeanFwd>,
+    std::decay_t<DeviationFwd>, std::decay_t<BeginFwd>,
+    std::decay_t<EndFwd>, void>;
+
+  template<typename MeanFwd, typename DeviationFwd, typename BeginFwd,
+    typename EndFwd, typename GranularityFwd>
+  TruncatedNormal(MeanFwd&&, DeviationFwd&&, BeginFwd&&, EndFwd&&,
+    GranularityFwd&&, Interval = Interval::CLOSED) -> TruncatedNormal<
+    std::decay_t<MeanFwd>, std::decay_t<DeviationFwd>,
+    std::decay_t<BeginFwd>, std::decay_t<EndFwd>,
+    std::decay_t<GranularityFwd>>;
+
+  template<typename M, typename D, typename B, typename E, typename G,
+    typename R>
+  struct is_batchable<TruncatedNormal<M, D, B, E, G, R>> : std::bool_constant<
+    is_batchable_v<typename TruncatedNormal<M, D, B, E, G, R>::Mean> &&
+    is_batchable_v<typename TruncatedNormal<M, D, B, E, G, R>::Deviation> &&
+    is_batchable_v<typename TruncatedNormal<M, D, B, E, G, R>::Begin> &&
+    is_batchable_v<typename TruncatedNormal<M, D, B, E, G, R>::End> &&
+    (std::is_same_v<G, void> || is_batchable_v<
+      typename TruncatedNormal<M, D, B, E, G, R>::Granularity>)> {};
+
+  template<typename M, typename D, typename B, typename E, typename G,
+    typename R>
+  struct is_static_tree<TruncatedNormal<M, D, B, E, G, R>> :
+    std::bool_constant<
+    is_static_tree_v<typename TruncatedNormal<M, D, B, E, G, R>::Mean> &&
+    is_static_tree_v<typename TruncatedNormal<M, D, B, E, G, R>::Deviation> &&
+    is_static_tree_v<typename TruncatedNormal<M, D, B, E, G, R>::Begin> &&
+    is_static_tree_v<typename TruncatedNormal<M, D, B, E, G, R>::End> &&
+    (std::is_same_v<G, void> || is_static_tree_v<
+      typename TruncatedNormal<M, D, B, E, G, R>::Granularity>)> {};
+
+  template<typename M, typename D, typename B, typename E, typename G,
+    typename R>
+  template<typename MeanFwd, typename DeviationFwd, typename BeginFwd,
+    typename EndFwd>
+  TruncatedNormal<M, D, B, E, G, R>::TruncatedNormal(MeanFwd&& mean,
+      DeviationFwd&& deviation, BeginFwd&& begin, EndFwd&& end,
+      Interval interval)
+      : m_mean(std::forward<MeanFwd>(mean)),
+        m_deviation(std::forward<DeviationFwd>(deviation)),
+        m_begin(std::forward<BeginFwd>(begin)),
+        m_end(std::forward<EndFwd>(end)),
+        m_interval(interval),
+        m_engine(next_seed()),
+        m_parameters(0, 1, 0, 0),
+        m_quantile(0, 1, 0, 0) {}
+
+  template<typename M, typename D, typename B, typename E, typename G,
+    typename R>
+  template<typename MeanFwd, typename DeviationFwd, typename BeginFwd,
+    typename EndFwd, typename GranularityFwd>
+  TruncatedNormal<M, D, B, E, G, R>::TruncatedNormal(MeanFwd&& mean,
+      DeviationFwd&& deviation, BeginFwd&& begin, EndFwd&& end,
+      GranularityFwd&& granularity, Interval interval)
+      : m_mean(std::forward<MeanFwd>(mean)),
+        m_deviation(std::forward<DeviationFwd>(deviation)),
+        m_begin(std::forward<BeginFwd>(begin)),
+        m_end(std::forward<EndFwd>(end)),
+        m_granularity(std::forward<GranularityFwd>(granularity)),
+        m_interval(interval),
+        m_engine(next_seed()),
+        m_parameters(0, 1, 0, 0),
+        m_quantile(0, 1, 0, 0) {}
+
+  template<typename M, typename D, typename B, typename E, typename G,
+    typename R>
+  typename TruncatedNormal<M, D, B, E, G, R>::Type
+      TruncatedNormal<M, D, B, E, G, R>::generate(Evaluator& evaluator) {
+    auto begin = evaluator.evaluate(m_begin);
+    auto end = evaluator.evaluate(m_end);
+    auto& quantile = get_quantile(evaluator.evaluate(m_mean),
+      evaluator.evaluate(m_deviation), begin, end);
+    auto fraction = Details::draw_unit(m_engine);
+    if constexpr(std::is_same_v<G, void>) {
+      return draw(fraction, quantile, begin, end);
+    } else {
+      return draw(fraction, quantile, begin, end,
+        evaluator.evaluate(m_granularity));
+    }
+  }
+
+  template<typename M, typename D, typename B, typename E, typename G,
+    typename R>
+  template<typename OutputIterator>
+  OutputIterator TruncatedNormal<M, D, B, E, G, R>::generate_batch(
+      std::size_t count, OutputIterator out) {
+    auto mean = Details::BatchColumn<Mean>();
+    auto deviation = Details::BatchColumn<Deviation>();
+    auto begin = Details::BatchColumn<Begin>();
+    auto end = Details::BatchColumn<End>();
+    auto granularity = GranularityColumn();
+    auto lanes = Details::Lanes();
+    for(auto i = std::size_t(0); i < count; i += BATCH_BLOCK_SIZE) {
+      auto size = std::min(BATCH_BLOCK_SIZE, count - i);
+      mean.fill(m_mean, size);
+      deviation.fill(m_deviation, size);
+      begin.fill(m_begin, size);
+      end.fill(m_end, size);
+      if constexpr(!std::is_same_v<G, void>) {
+        granularity.fill(m_granularity, size);
+      }
+      for(auto j = std::size_t(0); j < size; j += SAMPLING_LANES) {
+        Details::draw_uniform(m_engine, lanes);
+        auto width = std::min(SAMPLING_LANES, size - j);
+        for(auto k = std::size_t(0); k != width; ++k) {
+          auto row = j + k;
+          auto& quantile = get_quantile(mean[row], deviation[row],
+            Type(begin[row]), Type(end[row]));
+          if constexpr(std::is_same_v<G, void>) {
+            *out = draw(lanes[k], quantile, begin[row], end[row]);
+          } else {
+            *out = draw(lanes[k], quantile, begin[row], end[row],
+              granularity[row]);
+          }
+          ++out;
+        }
+      }
+    }
+    return out;
+  }
+
+  template<typename M, typename D, typename B, typename E, typename G,
+    typename R>
+  typename TruncatedNormal<M, D, B, E, G, R>::Type
+      TruncatedNormal<M, D, B, E, G, R>::transform(Evaluator& evaluator,
+      double fraction) {
+    auto begin = evaluator.evaluate(m_begin);
+    auto end = evaluator.evaluate(m_end);
+    auto value = get_quantile(evaluator.evaluate(m_mean),
+      evaluator.evaluate(m_deviation), begin, end)(fraction);
+    if constexpr(std::is_same_v<G, void>) {
+      return Details::admit(Details::snap<Type>(value), Type(begin),
+        Type(end), m_interval);
+    } else {
+      auto granularity = evaluator.evaluate(m_granularity);
+      return Details::admit(Details::snap<Type>(value, granularity),
+        Type(begin), Type(end), m_interval, granularity);
+    }
+  }
+
+  template<typename M, typename D, typename B, typename E, typename G,
+    typename R>
+  typename TruncatedNormal<M, D, B, E, G, R>::Engine&
+      TruncatedNormal<M, D, B, E, G, R>::get_engine() {
+    return m_engine;
+  }
+
+  template<typename M, typename D, typename B, typename E, typename G,
+    typename R>
+  const Details::TruncatedNormalQuantile&
+      TruncatedNormal<M, D, B, E, G, R>::get_quantile(double mean,
+      double deviation, double begin, double end) {
+    auto parameters = std::tuple(mean, deviation, begin, end);
+    if(parameters != m_parameters) {
+      m_parameters = parameters;
+      m_quantile = Details::TruncatedNormalQuantile(mean, deviation, begin,
+        end);
+    }
+    return m_quantile;
+  }
+
+  template<typename M, typename D, typename B, typename E, typename G,
+    typename R>
+  template<typename... GranularityType>
+  typename TruncatedNormal<M, D, B, E, G, R>::Type
+      TruncatedNormal<M, D, B, E, G, R>::draw(double fraction,
+      const Details::TruncatedNormalQuantile& quantile, const Type& begin,
+      const Type& end, const GranularityType&... granularity) {
+    if(begin == end) {
+      return begin;
+    }
+    if(!Details::has_admissible_value(begin, end, m_interval,
+        granularity...)) {
+      return Details::snap<Type>(static_cast<double>(begin),
+        granularity...);
+    }
+    while(true) {
+      auto value = Details::snap<Type>(quantile(fraction), granularity...);
+      if(Details::is_within(value, begin, end, m_interval)) {
+        return value;
+      }
+      fraction = Details::draw_unit(m_engine);
+    }
+  }
+}
+
+#endif
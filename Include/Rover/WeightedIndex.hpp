@@ -0,0 +1,239 @@
+#ifndef ROVER_WEIGHTED_INDEX_HPP
+#define ROVER_WEIGHTED_INDEX_HPP
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "Rover/Batch.hpp"
+#include "Rover/Evaluator.hpp"
+#include "Rover/Random.hpp"
+
+namespace Rover {
+namespace Details {
+
+  /** Samples an index proportionally to its weight in constant time using
+      Vose's alias method. */
+  class AliasTable {
+    public:
+
+      //! Builds the table.
+      /*!
+        \param begin The first weight.
+        \param end One past the last weight.
+        \details Weights must be non-negative. If they are all zero, the
+                 indices are sampled uniformly.
+      */
+      template<typename Iterator>
+      void build(Iterator begin, Iterator end);
+
+      //! Samples an index.
+      template<typename Engine>
+      std::size_t sample(Engine& engine) const;
+
+    private:
+      std::vector<double> m_probabilities;
+      std::vector<std::size_t> m_aliases;
+  };
+
+  template<typename Iterator>
+  void AliasTable::build(Iterator begin, Iterator end) {
+    auto size = static_cast<std::size_t>(std::distance(begin, end));
+    auto total = std::accumulate(begin, end, 0.);
+    m_probabilities.assign(size, 1.);
+    m_aliases.resize(size);
+    std::iota(m_aliases.begin(), m_aliases.end(), std::size_t(0));
+    if(total <= 0) {
+      return;
+    }
+    auto scaled = std::vector<double>();
+    scaled.reserve(size);
+    std::transform(begin, end, std::back_inserter(scaled), [&](auto weight) {
+      return weight * size / total;
+    });
+    auto small = std::vector<std::size_t>();
+    auto large = std::vector<std::size_t>();
+    for(auto i = std::size_t(0); i < size; ++i) {
+      if(scaled[i] < 1) {
+        small.push_back(i);
+      } else {
+        large.push_back(i);
+      }
+    }
+    while(!small.empty() && !large.empty()) {
+      auto less = small.back();
+      small.pop_back();
+      auto more = large.back();
+      m_probabilities[less] = scaled[less];
+      m_aliases[less] = more;
+      scaled[more] = (scaled[more] + scaled[less]) - 1;
+      if(scaled[more] < 1) {
+        large.pop_back();
+        small.push_back(more);
+      }
+    }
+  }
+
+  template<typename Engine>
+  std::size_t AliasTable::sample(Engine& engine) const {
+    auto index = std::uniform_int_distribution<std::size_t>(0,
+      m_probabilities.size() - 1)(engine);
+    if(std::generate_canonical<double, 32>(engine) <
+        m_probabilities[index]) {
+      return index;
+    }
+    return m_aliases[index];
+  }
+}
+
+  //! Generates an index with a probability proportional to its weight.
+  /*!
+    \tparam R The type of random engine.
+    \details Indices are grouped into blocks of about the square root of
+             their count, each block holding an alias table over its
+             indices, and a top-level alias table chooses among the blocks.
+             Sampling takes constant time and updating a weight takes time
+             proportional to the square root of the number of weights.
+  */
+  template<typename R = DefaultEngine>
+  class WeightedIndex {
+    public:
+
+      //! The type of random engine.
+      using Engine = R;
+
+      using Type = int;
+
+      //! Constructs a WeightedIndex.
+      /*!
+        \param weights The non-negative weights of the indices, at least one
+                       of which must be positive.
+        \throw std::invalid_argument If there are no weights.
+        \details The engine is seeded with next_seed.
+      */
+      explicit WeightedIndex(std::vector<double> weights);
+
+      Type generate(Evaluator& evaluator);
+
+      //! Produces independent values in bulk.
+      /*!
+        \param count The number of values to produce.
+        \param out The output iterator receiving the values.
+        \return The output iterator past the last value written.
+      */
+      template<typename OutputIterator>
+      OutputIterator generate_batch(std::size_t count, OutputIterator out);
+
+      //! Returns the number of indices.
+      std::size_t size() const;
+
+      //! Returns the weight of an index.
+      double get_weight(std::size_t index) const;
+
+      //! Updates the weight of an index.
+      /*!
+        \param index The index to update.
+        \param weight The non-negative weight of the index.
+      */
+      void set_weight(std::size_t index, double weight);
+
+      //! Returns the random engine.
+      Engine& get_engine();
+
+    private:
+      std::vector<double> m_weights;
+      std::size_t m_block_size;
+      std::vector<double> m_block_weights;
+      std::vector<Details::AliasTable> m_blocks;
+      Details::AliasTable m_table;
+      Engine m_engine;
+
+      void build_block(std::size_t block);
+      Type sample();
+  };
+
+  WeightedIndex(std::vector<double>) -> WeightedIndex<>;
+
+  template<typename R>
+  struct is_batchable<WeightedIndex<R>> : std::true_type {};
+
+  template<typename R>
+  struct is_static_tree<WeightedIndex<R>> : std::true_type {};
+
+  template<typename R>
+  WeightedIndex<R>::WeightedIndex(std::vector<double> weights)
+      : m_weights(std::move(weights)),
+        m_block_size(std::max(std::size_t(1), static_cast<std::size_t>(
+          std::ceil(std::sqrt(static_cast<double>(m_weights.size())))))),
+        m_block_weights((m_weights.size() + m_block_size - 1) / m_block_size),
+        m_blocks(m_block_weights.size()),
+        m_engine(next_seed()) {
+    if(m_weights.empty()) {
+      throw std::invalid_argument("WeightedIndex has no weights.");
+    }
+    for(auto i = std::size_t(0); i < m_blocks.size(); ++i) {
+      build_block(i);
+    }
+    m_table.build(m_block_weights.begin(), m_block_weights.end());
+  }
+
+  template<typename R>
+  typename WeightedIndex<R>::Type WeightedIndex<R>::generate(Evaluator&) {
+    return sample();
+  }
+
+  template<typename R>
+  template<typename OutputIterator>
+  OutputIterator WeightedIndex<R>::generate_batch(std::size_t count,
+      OutputIterator out) {
+    for(auto i = std::size_t(0); i < count; ++i) {
+      *out = sample();
+      ++out;
+    }
+    return out;
+  }
+
+  template<typename R>
+  std::size_t WeightedIndex<R>::size() const {
+    return m_weights.size();
+  }
+
+  template<typename R>
+  double WeightedIndex<R>::get_weight(std::size_t index) const {
+    return m_weights[index];
+  }
+
+  template<typename R>
+  void WeightedIndex<R>::set_weight(std::size_t index, double weight) {
+    m_weights[index] = weight;
+    build_block(index / m_block_size);
+    m_table.build(m_block_weights.begin(), m_block_weights.end());
+  }
+
+  template<typename R>
+  typename WeightedIndex<R>::Engine& WeightedIndex<R>::get_engine() {
+    return m_engine;
+  }
+
+  template<typename R>
+  void WeightedIndex<R>::build_block(std::size_t block) {
+    auto begin = m_weights.begin() + block * m_block_size;
+    auto end = m_weights.begin() + std::min(m_weights.size(),
+      (block + 1) * m_block_size);
+    m_block_weights[block] = std::accumulate(begin, end, 0.);
+    m_blocks[block].build(begin, end);
+  }
+
+  template<typename R>
+  typename WeightedIndex<R>::Type WeightedIndex<R>::sample() {
+    auto block = m_table.sample(m_engine);
+    return static_cast<Type>(block * m_block_size +
+      m_blocks[block].sample(m_engine));
+  }
+}
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef ROVER_WEIGHTED_RANDOM_PICK_HPP
+#define ROVER_WEIGHTED_RANDOM_PICK_HPP
+#include <stdexcept>
+#include <vector>
+#include "Rover/Batch.hpp"
+#include "Rover/Evaluator.hpp"
+#include "Rover/Pick.hpp"
+#include "Rover/WeightedIndex.hpp"
+
+namespace Rover {
+
+  //! An argument generator that evaluates to one of the arguments with a
+  //! likelyhood proportional to its weight.
+  /*!
+    \tparam G The types of the generators.
+  */
+  template<typename... G>
+  class WeightedRandomPick {
+    private:
+      using PickType = Pick<WeightedIndex<>, G...>;
+
+    public:
+
+      //! The type of generated values.
+      using Type = typename PickType::Type;
+
+      //! Constructs WeightedRandomPick.
+      /*!
+        \param weights The non-negative weights of the generators, at least
+                       one of which must be positive.
+        \param generators One or more generators evaluating to the same type.
+        \throw std::invalid_argument If there is not one weight per
+               generator.
+      */
+      template<typename... GeneratorsFwd>
+      explicit WeightedRandomPick(std::vector<double> weights,
+        GeneratorsFwd&&... generators);
+
+      //! Evaluates the generator.
+      Type generate(Evaluator& evaluator);
+
+      //! Produces independent values in bulk.
+      /*!
+        \param count The number of values to produce.
+        \param out The output iterator receiving the values.
+        \return The output iterator past the last value written.
+      */
+      template<typename OutputIterator>
+      OutputIterator generate_batch(std::size_t count, OutputIterator out);
+
+      //! Returns the weight of a generator.
+      double get_weight(std::size_t index) const;
+
+      //! Updates the weight of a generator.
+      /*!
+        \param index The index of the generator.
+        \param weight The non-negative weight of the generator.
+      */
+      void set_weight(std::size_t index, double weight);
+
+    private:
+      PickType m_pick;
+  };
+
+  template<typename... GeneratorsFwd>
+  WeightedRandomPick(std::vector<double>, GeneratorsFwd&&...) ->
+    WeightedRandomPick<std::decay_t<GeneratorsFwd>...>;
+
+  template<typename... G>
+  struct is_batchable<WeightedRandomPick<G...>> : std::bool_constant<
+    is_batchable_v<Pick<WeightedIndex<>, G...>>> {};
+
+  template<typename... G>
+  struct is_static_tree<WeightedRandomPick<G...>> : std::bool_constant<
+    is_static_tree_v<Pick<WeightedIndex<>, G...>>> {};
+
+  template<typename... G>
+  template<typename... GeneratorsFwd>
+  WeightedRandomPick<G...>::WeightedRandomPick(std::vector<double> weights,
+      GeneratorsFwd&&... generators)
+    : m_pick(WeightedIndex(std::move(weights)),
+        std::forward<GeneratorsFwd>(generators)...) {
+    if(m_pick.get_choice().size() != sizeof...(G)) {
+      throw std::invalid_argument("Weights do not match the generators.");
+    }
+  }
+
+  template<typename... G>
+  typename WeightedRandomPick<G...>::Type WeightedRandomPick<G...>::generate(
+      Evaluator& evaluator) {
+    return m_pick.generate(evaluator);
+  }
+
+  template<typename... G>
+  template<typename OutputIterator>
+  OutputIterator WeightedRandomPick<G...>::generate_batch(std::size_t count,
+      OutputIterator out) {
+    return m_pick.generate_batch(count, std::move(out));
+  }
+
+  template<typename... G>
+  double WeightedRandomPick<G...>::get_weight(std::size_t index) const {
+    return m_pick.get_choice().get_weight(index);
+  }
+
+  template<typename... G>
+  void WeightedRandomPick<G...>::set_weight(std::size_t index, double weight) {
+    m_pick.get_choice().set_weight(index, weight);
+  }
+}
+
+#endif
@@ -17,8 +17,8 @@ namespace Rover::Details {
       PythonBox(pybind11::object obj)
         : m_obj(std::move(obj)) {}
 
-      bool is_same(const PythonBox<T>& right) const {
-        return m_obj.is(right.m_obj);
+      const void* get_identity() const {
+        return m_obj.ptr();
       }
 
       Type generate(Evaluator& e) {
@@ -33,16 +33,15 @@ namespace Rover::Details {
       pybind11::object m_obj;
   };
 
+  template<typename T>
+  const void* get_identity(const PythonBox<T>& generator) {
+    return generator.get_identity();
+  }
+
   bool is_python_generator(const pybind11::object& arg);
 }
 
 namespace Rover {
-  template<typename T>
-  bool is_same(const Details::PythonBox<T>& left,
-      const Details::PythonBox<T>& right) {
-    return left.is_same(right);
-  }
-
   template<typename T, typename ArgFwd>
   Box<T> python_autobox(ArgFwd&& arg) {
     if(Details::is_python_generator(arg)) {
@@ -0,0 +1,15 @@
+#ifndef ROVER_PYTHON_DISTRIBUTIONS_HPP
+#define ROVER_PYTHON_DISTRIBUTIONS_HPP
+#include <pybind11/pybind11.h>
+
+namespace Rover {
+
+  //! Exports the Normal, Exponential, LogUniform and TruncatedNormal
+  //! classes over floating point parameters.
+  /*!
+    \param module The module to export the classes to.
+  */
+  void export_distributions(pybind11::module& module);
+}
+
+#endif
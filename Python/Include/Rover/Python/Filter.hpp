@@ -40,7 +40,13 @@ namespace Rover {
                pybind11::cast(value)).template cast<bool>();
            }, std::move(generator));
        }))
-      .def("generate", &FilterType::generate);
+      .def("generate", &FilterType::generate)
+      .def_property("max_attempts", &FilterType::get_max_attempts,
+        &FilterType::set_max_attempts)
+      .def_property_readonly("attempts", &FilterType::attempts)
+      .def_property_readonly("acceptances", &FilterType::acceptances)
+      .def_property_readonly("acceptance_rate",
+        &FilterType::acceptance_rate);
     pybind11::implicitly_convertible<FilterType,
       Box<typename FilterType::Type>>();
     pybind11::implicitly_convertible<FilterType, Box<pybind11::object>>();
@@ -0,0 +1,11 @@
+#ifndef ROVER_PYTHON_RANDOM_HPP
+#define ROVER_PYTHON_RANDOM_HPP
+#include <pybind11/pybind11.h>
+
+namespace Rover {
+
+  //! Exports the seed hierarchy.
+  void export_random(pybind11::module& module);
+}
+
+#endif
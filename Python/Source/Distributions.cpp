@@ -0,0 +1,100 @@
+#include "Rover/Python/Distributions.hpp"
+#include <utility>
+#include <variant>
+#include "Rover/Exponential.hpp"
+#include "Rover/LogUniform.hpp"
+#include "Rover/Normal.hpp"
+#include "Rover/Python/Autobox.hpp"
+#include "Rover/TruncatedNormal.hpp"
+
+using namespace Rover;
+using namespace pybind11;
+
+namespace {
+  using Parameter = Box<double>;
+
+  Parameter make_parameter(object value) {
+    return python_autobox<double>(std::move(value));
+  }
+
+  /** Wraps one of several distributions drawing doubles, so that it can be
+      used as a Python generator. */
+  template<typename... D>
+  class PythonDistribution {
+    public:
+      using Type = object;
+
+      PythonDistribution(std::variant<D...> impl)
+        : m_impl(std::move(impl)) {}
+
+      Type generate(Evaluator& evaluator) {
+        return std::visit([&](auto& impl) {
+          return cast(impl.generate(evaluator));
+        }, m_impl);
+      }
+
+    private:
+      std::variant<D...> m_impl;
+  };
+
+  using PythonNormal = PythonDistribution<Normal<Parameter, Parameter>>;
+
+  using PythonExponential = PythonDistribution<Exponential<Parameter>>;
+
+  using PythonLogUniform = PythonDistribution<
+    LogUniform<Parameter, Parameter>,
+    LogUniform<Parameter, Parameter, Parameter>>;
+
+  using PythonTruncatedNormal = PythonDistribution<
+    TruncatedNormal<Parameter, Parameter, Parameter, Parameter>,
+    TruncatedNormal<Parameter, Parameter, Parameter, Parameter, Parameter>>;
+}
+
+void Rover::export_distributions(module& module) {
+  class_<PythonNormal>(module, "Normal")
+    .def(init([](object mean, object deviation) {
+      return PythonNormal(Normal(make_parameter(std::move(mean)),
+        make_parameter(std::move(deviation))));
+    }))
+    .def("generate", &PythonNormal::generate);
+  implicitly_convertible<PythonNormal, Box<object>>();
+  class_<PythonExponential>(module, "Exponential")
+    .def(init([](object rate) {
+      return PythonExponential(Exponential(make_parameter(std::move(rate))));
+    }))
+    .def("generate", &PythonExponential::generate);
+  implicitly_convertible<PythonExponential, Box<object>>();
+  class_<PythonLogUniform>(module, "LogUniform")
+    .def(init([](object begin, object end, Interval interval) {
+      return PythonLogUniform(LogUniform(make_parameter(std::move(begin)),
+        make_parameter(std::move(end)), interval));
+    }), arg("begin"), arg("end"), arg("interval") = Interval::CLOSED)
+    .def(init([](object begin, object end, object granularity,
+        Interval interval) {
+      return PythonLogUniform(LogUniform(make_parameter(std::move(begin)),
+        make_parameter(std::move(end)),
+        make_parameter(std::move(granularity)), interval));
+    }), arg("begin"), arg("end"), arg("granularity"),
+      arg("interval") = Interval::CLOSED)
+    .def("generate", &PythonLogUniform::generate);
+  implicitly_convertible<PythonLogUniform, Box<object>>();
+  class_<PythonTruncatedNormal>(module, "TruncatedNormal")
+    .def(init([](object mean, object deviation, object begin, object end,
+        Interval interval) {
+      return PythonTruncatedNormal(TruncatedNormal(
+        make_parameter(std::move(mean)), make_parameter(std::move(deviation)),
+        make_parameter(std::move(begin)), make_parameter(std::move(end)),
+        interval));
+    }), arg("mean"), arg("deviation"), arg("begin"), arg("end"),
+      arg("interval") = Interval::CLOSED)
+    .def(init([](object mean, object deviation, object begin, object end,
+        object granularity, Interval interval) {
+      return PythonTruncatedNormal(TruncatedNormal(
+        make_parameter(std::move(mean)), make_parameter(std::move(deviation)),
+        make_parameter(std::move(begin)), make_parameter(std::move(end)),
+        make_parameter(std::move(granularity)), interval));
+    }), arg("mean"), arg("deviation"), arg("begin"), arg("end"),
+      arg("granularity"), arg("interval") = Interval::CLOSED)
+    .def("generate", &PythonTruncatedNormal::generate);
+  implicitly_convertible<PythonTruncatedNormal, Box<object>>();
+}
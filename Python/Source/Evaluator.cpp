@@ -1,4 +1,5 @@
 #include "Rover/Python/Evaluator.hpp"
+#include <pybind11/stl.h>
 #include "Rover/Evaluator.hpp"
 #include "Rover/Python/Box.hpp"
 
@@ -6,7 +7,30 @@ using namespace pybind11;
 using namespace Rover;
 
 void Rover::export_evaluator(module& module) {
+  class_<GeneratorProfile>(module, "GeneratorProfile")
+    .def_property_readonly("identity", [](const GeneratorProfile& self) {
+      return reinterpret_cast<std::uintptr_t>(self.m_identity);
+    })
+    .def_property_readonly("type", [](const GeneratorProfile& self) {
+      return std::string(self.m_type->name());
+    })
+    .def_readonly("evaluations", &GeneratorProfile::m_evaluations)
+    .def_readonly("hits", &GeneratorProfile::m_hits)
+    .def_readonly("misses", &GeneratorProfile::m_misses)
+    .def_property_readonly("total_time", [](const GeneratorProfile& self) {
+      return std::chrono::duration<double>(self.m_total_time).count();
+    })
+    .def_property_readonly("self_time", [](const GeneratorProfile& self) {
+      return std::chrono::duration<double>(self.m_self_time).count();
+    });
   class_<Evaluator>(module, "Evaluator")
     .def(init<>())
-    .def("evaluate", &Evaluator::evaluate<Box<object>>);
+    .def("evaluate", &Evaluator::evaluate<Box<object>>)
+    .def("invalidate", &Evaluator::invalidate<Box<object>>)
+    .def("reset", &Evaluator::reset)
+    .def_property("tracking_dependencies",
+      &Evaluator::is_tracking_dependencies,
+      &Evaluator::set_dependency_tracking)
+    .def("profile", &Evaluator::profile)
+    .def("reset_profile", &Evaluator::reset_profile);
 }
@@ -12,11 +12,22 @@ void Rover::export_filter(module& module) {
          return predicate.attr("__call__")(std::move(obj)).cast<bool>();
        }, python_autobox<object>(std::move(generator)));
      }))
+    .def(init([](object predicate, object generator,
+        std::size_t max_attempts) {
+       return FilterType([predicate = std::move(predicate)](object obj) {
+         return predicate.attr("__call__")(std::move(obj)).cast<bool>();
+       }, python_autobox<object>(std::move(generator)), max_attempts);
+     }))
     .def(init([](object filter) {
        return FilterType([](object) {
          return true;
        }, python_autobox<object>(std::move(filter)));
      }))
-    .def("generate", &FilterType::generate);
+    .def("generate", &FilterType::generate)
+    .def_property("max_attempts", &FilterType::get_max_attempts,
+      &FilterType::set_max_attempts)
+    .def_property_readonly("attempts", &FilterType::attempts)
+    .def_property_readonly("acceptances", &FilterType::acceptances)
+    .def_property_readonly("acceptance_rate", &FilterType::acceptance_rate);
   implicitly_convertible<FilterType, Box<object>>();
 }
@@ -0,0 +1,10 @@
+#include "Rover/Python/Random.hpp"
+#include "Rover/Random.hpp"
+
+using namespace pybind11;
+using namespace Rover;
+
+void Rover::export_random(module& module) {
+  module.def("set_root_seed", &set_root_seed);
+  module.def("next_seed", &next_seed);
+}
@@ -2,6 +2,7 @@
 #include "Rover/Python/Box.hpp"
 #include "Rover/Python/Constant.hpp"
 #include "Rover/Python/CsvParser.hpp"
+#include "Rover/Python/Distributions.hpp"
 #include "Rover/Python/Evaluator.hpp"
 #include "Rover/Python/Filter.hpp"
 #include "Rover/Python/Generator.hpp"
@@ -10,6 +11,7 @@
 #include "Rover/Python/ListTrial.hpp"
 #include "Rover/Python/Model.hpp"
 #include "Rover/Python/Pick.hpp"
+#include "Rover/Python/Random.hpp"
 #include "Rover/Python/RandomPick.hpp"
 #include "Rover/Python/Range.hpp"
 #include "Rover/Python/Sample.hpp"
@@ -21,10 +23,12 @@ using namespace pybind11;
 using namespace Rover;
 
 PYBIND11_MODULE(rover, module) {
+  export_random(module);
   export_evaluator(module);
   export_box(module);
   export_constant(module);
   export_range(module);
+  export_distributions(module);
   export_lift(module);
   export_sample(module);
   export_list_trial(module);
@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/AsyncTrialRunner.hpp"
+#include "Rover/Constant.hpp"
+#include "Rover/Range.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_async_trial_runner", "[AsyncTrialRunner]") {
+  SECTION("Samples.") {
+    auto runner = AsyncTrialRunner([] {
+        return std::tuple(Range(0, 100), Range(0, 100));
+      }, [](int x, int y) {
+        return std::async(std::launch::async, [=] {
+          return x + y;
+        });
+      }, 4);
+    REQUIRE(runner.max_in_flight() == 4);
+    auto trial = runner.run(200);
+    REQUIRE(trial.size() == 200);
+    for(auto& sample : trial) {
+      auto [x, y] = sample.m_arguments;
+      REQUIRE(x >= 0);
+      REQUIRE(x <= 100);
+      REQUIRE(y >= 0);
+      REQUIRE(y <= 100);
+      REQUIRE(sample.m_result == x + y);
+    }
+  }
+  SECTION("Deferred.") {
+    auto runner = AsyncTrialRunner([] {
+        return std::tuple(Constant(3));
+      }, [](int x) {
+        return std::async(std::launch::deferred, [=] {
+          return 2 * x;
+        });
+      }, 2);
+    auto trial = ListTrial<Sample<int, int>>();
+    runner.run(10, trial);
+    runner.run(5, trial);
+    REQUIRE(trial.size() == 15);
+    for(auto& sample : trial) {
+      REQUIRE(sample.m_result == 6);
+    }
+  }
+  SECTION("Empty.") {
+    auto runner = AsyncTrialRunner([] {
+        return std::tuple(Constant(3));
+      }, [](int x) {
+        return std::async(std::launch::deferred, [=] {
+          return x;
+        });
+      }, 2);
+    REQUIRE(runner.run(0).size() == 0);
+  }
+}
+
+TEST_CASE("test_async_trial_runner_in_flight", "[AsyncTrialRunner]") {
+  SECTION("Bounded.") {
+    auto outstanding = std::atomic<int>(0);
+    auto peak = std::atomic<int>(0);
+    auto runner = AsyncTrialRunner([] {
+        return std::tuple(Constant(1));
+      }, [&](int x) {
+        auto current = ++outstanding;
+        auto previous = peak.load();
+        while(previous < current &&
+          !peak.compare_exchange_weak(previous, current)) {}
+        return std::async(std::launch::async, [&, x] {
+          std::this_thread::sleep_for(std::chrono::milliseconds(2));
+          --outstanding;
+          return x;
+        });
+      }, 3);
+    REQUIRE(runner.run(30).size() == 30);
+    REQUIRE(peak > 1);
+    REQUIRE(peak <= 3);
+  }
+  SECTION("Completion order.") {
+    auto promises = std::vector<std::promise<int>>(4);
+    auto next = std::size_t(0);
+    auto runner = AsyncTrialRunner([] {
+        return std::tuple(Range(0, 1000));
+      }, [&](int) {
+        return promises[next++].get_future();
+      }, 4);
+    auto resolver = std::thread([&] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      for(auto i = promises.size(); i-- != 0;) {
+        promises[i].set_value(static_cast<int>(i));
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      }
+    });
+    auto trial = runner.run(4);
+    resolver.join();
+    REQUIRE(trial.size() == 4);
+    for(auto i = std::size_t(0); i != trial.size(); ++i) {
+      REQUIRE(trial[i].m_result == static_cast<int>(3 - i));
+    }
+  }
+}
+
+TEST_CASE("test_async_trial_runner_exceptions", "[AsyncTrialRunner]") {
+  auto evaluations = std::atomic<int>(0);
+  auto runner = AsyncTrialRunner([] {
+      return std::tuple(Constant(1));
+    }, [&](int x) {
+      auto index = evaluations++;
+      return std::async(std::launch::async, [=] {
+        if(index == 5) {
+          throw std::runtime_error("Evaluation failed.");
+        }
+        return x;
+      });
+    }, 2);
+  auto trial = ListTrial<Sample<int, int>>();
+  REQUIRE_THROWS_AS(runner.run(100, trial), std::runtime_error);
+  REQUIRE(evaluations < 100);
+  REQUIRE(trial.size() == static_cast<std::size_t>(evaluations - 1));
+}
+
+TEST_CASE("test_async_trial_runner_seed", "[AsyncTrialRunner]") {
+  auto make_runner = [] {
+    return AsyncTrialRunner([] {
+        return std::tuple(Range(0, 1000000));
+      }, [](int x) {
+        return std::async(std::launch::async, [=] {
+          std::this_thread::sleep_for(std::chrono::microseconds(x % 100));
+          return x;
+        });
+      }, 8);
+  };
+  auto arguments = [](const auto& trial) {
+    auto values = std::vector<int>();
+    for(auto& sample : trial) {
+      values.push_back(std::get<0>(sample.m_arguments));
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  };
+  auto left = make_runner();
+  left.seed(42);
+  auto right = make_runner();
+  right.seed(42);
+  auto first = left.run(100);
+  REQUIRE(arguments(first) == arguments(right.run(100)));
+  REQUIRE(arguments(first) != arguments(left.run(100)));
+}
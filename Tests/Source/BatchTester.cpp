@@ -0,0 +1,152 @@
+#include <array>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Batch.hpp"
+#include "Rover/Box.hpp"
+#include "Rover/Constant.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/Lift.hpp"
+#include "Rover/Pick.hpp"
+#include "Rover/RandomPick.hpp"
+#include "Rover/Range.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_batchable", "[Batch]") {
+  static_assert(is_batchable_v<Constant<int>>);
+  static_assert(is_batchable_v<Range<int, int>>);
+  static_assert(is_batchable_v<Range<int, int, int>>);
+  static_assert(is_batchable_v<Range<Range<int, int>, int>>);
+  static_assert(!is_batchable_v<Range<Box<int>, int>>);
+  static_assert(!is_batchable_v<Range<Constant<int>*, int>>);
+  static_assert(is_batchable_v<Lift<int (*)(int, int), Constant<int>,
+    Range<int, int>>>);
+  static_assert(!is_batchable_v<Lift<int (*)(int, int), Constant<int>,
+    Box<int>>>);
+  static_assert(is_batchable_v<Pick<Constant<int>, Constant<int>,
+    Range<int, int>>>);
+  static_assert(!is_batchable_v<Pick<Box<int>, Constant<int>>>);
+  static_assert(is_batchable_v<RandomPick<Constant<int>, Constant<int>>>);
+  static_assert(!is_batchable_v<Box<int>>);
+}
+
+TEST_CASE("test_batch_constant", "[Batch]") {
+  auto constant = Constant(7);
+  auto values = std::vector<int>(1000);
+  auto end = generate_batch(constant, values.size(), values.begin());
+  REQUIRE(end == values.end());
+  for(auto value : values) {
+    REQUIRE(value == 7);
+  }
+}
+
+TEST_CASE("test_batch_range", "[Batch]") {
+  SECTION("Constant bounds.") {
+    auto range = Range(1, 10, Interval::OPEN);
+    auto values = std::array<int, 1000>();
+    generate_batch(range, values.size(), values.data());
+    auto counts = std::array<int, 11>();
+    for(auto value : values) {
+      REQUIRE(value >= 2);
+      REQUIRE(value <= 9);
+      ++counts[value];
+    }
+    for(auto i = 2; i <= 9; ++i) {
+      REQUIRE(counts[i] > 0);
+    }
+  }
+  SECTION("Generated bounds.") {
+    auto range = Range(Range(0, 10), Range(20, 30), 2);
+    auto values = std::vector<int>();
+    generate_batch(range, 1000, std::back_inserter(values));
+    REQUIRE(values.size() == 1000);
+    for(auto value : values) {
+      REQUIRE(value >= 0);
+      REQUIRE(value <= 30);
+      REQUIRE(value % 2 == 0);
+    }
+  }
+}
+
+TEST_CASE("test_batch_lift", "[Batch]") {
+  auto lift = Lift([](int a, int b, double c) {
+    return a + b + c;
+  }, Range(0, 10), Constant(100), Range(0., 1.));
+  auto values = std::vector<double>(1000);
+  generate_batch(lift, values.size(), values.begin());
+  for(auto value : values) {
+    REQUIRE(value >= 100.);
+    REQUIRE(value <= 111.);
+  }
+}
+
+TEST_CASE("test_batch_pick", "[Batch]") {
+  SECTION("Fixed choice.") {
+    auto pick = Pick(Constant(1), Constant(3), Constant(5), Constant(7));
+    auto values = std::vector<int>(1000);
+    generate_batch(pick, values.size(), values.begin());
+    for(auto value : values) {
+      REQUIRE(value == 5);
+    }
+  }
+  SECTION("Out of range choice.") {
+    auto i = -2;
+    auto pick = Pick(Lift([&] {
+      return i++ % 5;
+    }), Constant(3), Constant(5), Constant(7));
+    auto values = std::vector<int>(1000);
+    generate_batch(pick, values.size(), values.begin());
+    auto expected = std::vector<int>();
+    i = -2;
+    for(auto j = std::size_t(0); j != values.size(); ++j) {
+      expected.push_back(generate(pick));
+    }
+    REQUIRE(values == expected);
+  }
+  SECTION("Random choice.") {
+    auto pick = RandomPick(Constant(3), Range(10, 20));
+    auto values = std::vector<int>(1000);
+    generate_batch(pick, values.size(), values.begin());
+    auto threes = 0;
+    for(auto value : values) {
+      if(value == 3) {
+        ++threes;
+      } else {
+        REQUIRE(value >= 10);
+        REQUIRE(value <= 20);
+      }
+    }
+    REQUIRE(threes > 0);
+    REQUIRE(threes < 1000);
+  }
+}
+
+TEST_CASE("test_batch_fallback", "[Batch]") {
+  auto range = std::make_shared<Range<Constant<int>, Constant<int>>>(5, 10);
+  auto lift = Lift([](int a, int b) {
+    return b - a;
+  }, range, range);
+  auto values = std::vector<int>(100, 1);
+  generate_batch(lift, values.size(), values.begin());
+  for(auto value : values) {
+    REQUIRE(value == 0);
+  }
+}
+
+TEST_CASE("test_batch_columns", "[Batch]") {
+  auto range = Range(0, 1000);
+  auto lift = Lift([](int value) {
+    return 2 * value;
+  }, &range);
+  auto values = std::vector<int>(100);
+  auto doubles = std::vector<int>(100);
+  auto [values_end, doubles_end] = generate_columns(std::tie(range, lift),
+    values.size(), std::make_tuple(values.begin(), doubles.begin()));
+  REQUIRE(values_end == values.end());
+  REQUIRE(doubles_end == doubles.end());
+  for(auto i = std::size_t(0); i < values.size(); ++i) {
+    REQUIRE(doubles[i] == 2 * values[i]);
+  }
+}
@@ -0,0 +1,73 @@
+#include <sstream>
+#include <stdexcept>
+#include <catch2/catch.hpp>
+#include "Rover/BinaryCodec.hpp"
+#include "Rover/ColumnarTrial.hpp"
+#include "Rover/ListTrial.hpp"
+#include "Rover/Sample.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_binary_serialization", "[BinaryCodec]") {
+  SECTION("Empty trial.") {
+    auto trial = ListTrial<Sample<double, int, char>>();
+    auto stream = std::stringstream();
+    save_to_binary(trial, stream);
+    REQUIRE(stream.str().size() == BINARY_DATA_OFFSET);
+    auto loaded = ListTrial<Sample<double, int, char>>();
+    loaded.insert({ 1., { 2, 'a' } });
+    load_from_binary(stream, loaded);
+    REQUIRE(loaded.size() == 0);
+  }
+  SECTION("Round trip.") {
+    auto trial = ListTrial<Sample<double, int, char>>();
+    trial.insert({ 0.5, { 7, 'a' } });
+    trial.insert({ -1.25, { 3, 'b' } });
+    auto stream = std::stringstream();
+    save_to_binary(trial, stream);
+    REQUIRE(stream.str().size() ==
+      BINARY_DATA_OFFSET + 2 * sizeof(Sample<double, int, char>));
+    auto loaded = ColumnarTrial<Sample<double, int, char>>();
+    load_from_binary(stream, loaded);
+    REQUIRE(loaded.size() == 2);
+    REQUIRE(loaded[0].m_result == 0.5);
+    REQUIRE(std::get<0>(loaded[0].m_arguments) == 7);
+    REQUIRE(std::get<1>(loaded[0].m_arguments) == 'a');
+    REQUIRE(loaded[1].m_result == -1.25);
+    REQUIRE(std::get<0>(loaded[1].m_arguments) == 3);
+    REQUIRE(std::get<1>(loaded[1].m_arguments) == 'b');
+  }
+  SECTION("Traits.") {
+    REQUIRE(is_binary_sample_v<Sample<double, int, char>>);
+    REQUIRE(!is_binary_sample_v<Sample<double, std::string>>);
+  }
+}
+
+TEST_CASE("test_binary_deserialization_errors", "[BinaryCodec]") {
+  auto trial = ListTrial<Sample<double, int>>();
+  trial.insert({ 0.5, { 7 } });
+  trial.insert({ 1.5, { 8 } });
+  auto stream = std::stringstream();
+  save_to_binary(trial, stream);
+  auto contents = stream.str();
+  SECTION("Not a trial.") {
+    auto source = std::stringstream("5,7,abc\n");
+    auto loaded = ListTrial<Sample<double, int>>();
+    REQUIRE_THROWS_AS(load_from_binary(source, loaded), std::runtime_error);
+  }
+  SECTION("Different schema.") {
+    auto source = std::stringstream(contents);
+    auto loaded = ListTrial<Sample<double, float>>();
+    REQUIRE_THROWS_AS(load_from_binary(source, loaded), std::runtime_error);
+    source = std::stringstream(contents);
+    auto swapped = ListTrial<Sample<int, double>>();
+    REQUIRE_THROWS_AS(load_from_binary(source, swapped), std::runtime_error);
+  }
+  SECTION("Truncated.") {
+    auto source = std::stringstream(contents.substr(0, contents.size() - 1));
+    auto loaded = ListTrial<Sample<double, int>>();
+    loaded.insert({ 2.5, { 9 } });
+    REQUIRE_THROWS_AS(load_from_binary(source, loaded), std::runtime_error);
+    REQUIRE(loaded.size() == 1);
+  }
+}
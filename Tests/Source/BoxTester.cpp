@@ -86,3 +86,72 @@ TEST_CASE("test_shared_pointers", "[Box]") {
     }
   }
 }
+
+namespace {
+  template<std::size_t N>
+  class Tracked {
+    public:
+      using Type = int;
+
+      explicit Tracked(int value, int& instances)
+          : m_value(value),
+            m_instances(&instances) {
+        ++*m_instances;
+      }
+
+      Tracked(Tracked&& tracked) noexcept
+          : m_value(tracked.m_value),
+            m_instances(tracked.m_instances) {
+        ++*m_instances;
+      }
+
+      ~Tracked() {
+        --*m_instances;
+      }
+
+      Type generate(Evaluator& evaluator) {
+        return m_value;
+      }
+
+    private:
+      int m_value;
+      int* m_instances;
+      char m_padding[N];
+  };
+}
+
+TEST_CASE("test_storage", "[Box]") {
+  for(auto is_inline : {true, false}) {
+    auto instances = 0;
+    auto make = [&](int value) {
+      if(is_inline) {
+        return Box<int>(Tracked<1>(value, instances));
+      }
+      return Box<int>(Tracked<2 * Box<int>::INLINE_SIZE>(value, instances));
+    };
+    SECTION(is_inline ? "Inline move." : "Heap move.") {
+      {
+        auto b = make(3);
+        REQUIRE(instances == 1);
+        auto c = std::move(b);
+        REQUIRE(instances == 1);
+        REQUIRE(generate(c) == 3);
+      }
+      REQUIRE(instances == 0);
+    }
+    SECTION(is_inline ? "Inline assignment." : "Heap assignment.") {
+      {
+        auto b = make(3);
+        auto c = make(4);
+        REQUIRE(instances == 2);
+        c = std::move(b);
+        REQUIRE(instances == 1);
+        REQUIRE(generate(c) == 3);
+        b = make(5);
+        REQUIRE(instances == 2);
+        REQUIRE(generate(b) == 5);
+      }
+      REQUIRE(instances == 0);
+    }
+  }
+}
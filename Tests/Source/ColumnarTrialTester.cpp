@@ -0,0 +1,82 @@
+#include <catch2/catch.hpp>
+#include <string>
+#include "Rover/ColumnarTrial.hpp"
+#include "Rover/ListTrial.hpp"
+#include "Rover/Sample.hpp"
+#include "Rover/TrialView.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_columnar_trial_size_and_capacity", "[ColumnarTrial]") {
+  SECTION("Insert samples.") {
+    auto t = ColumnarTrial<Sample<int, double, char>>();
+    REQUIRE(t.size() == 0);
+    t.insert({ 1, { 0.5, 'a' } });
+    REQUIRE(t.size() == 1);
+    REQUIRE(t.capacity() >= 1);
+    t.insert({ 5, { 1.5, 'c' } });
+    REQUIRE(t.size() == 2);
+    REQUIRE(t.capacity() >= 2);
+  }
+  SECTION("Insert by iterators.") {
+    auto t = ColumnarTrial<Sample<int, double, char>>();
+    auto v = std::vector<Sample<int, double, char>>{
+      { 1, { 0.5, 'a' } }, { 5, { 1.5, 'c' } }
+    };
+    t.insert(v.begin(), v.end());
+    REQUIRE(t.size() == 2);
+    auto t2 = ListTrial<Sample<int, double, char>>();
+    t2.insert({ 4, { -0.5, 'b' } });
+    t.insert(t2.begin(), t2.end());
+    REQUIRE(t.size() == 3);
+    auto t3 = ColumnarTrial<Sample<int, double, char>>();
+    t3.insert(t.begin(), t.end());
+    REQUIRE(t3.size() == 3);
+  }
+  SECTION("Reserve") {
+    auto t = ColumnarTrial<Sample<int, double, char>>();
+    t.reserve(5);
+    REQUIRE(t.capacity() >= 5);
+    t.reserve(5000);
+    REQUIRE(t.capacity() >= 5000);
+  }
+}
+
+TEST_CASE("test_columnar_trial_values", "[ColumnarTrial]") {
+  SECTION("Rows.") {
+    auto t = ColumnarTrial<Sample<int, double, std::string>>();
+    t.insert({ 1, { 0.5, "a" } });
+    auto s = Sample<int, double, std::string>{ 5, { 1.5, "c" } };
+    t.insert(s);
+    t.insert(std::move(s));
+    REQUIRE(t[0].m_result == 1);
+    REQUIRE(std::get<0>(t[0].m_arguments) == 0.5);
+    REQUIRE(std::get<1>(t[0].m_arguments) == "a");
+    REQUIRE(t[2].m_result == 5);
+    REQUIRE(std::get<0>(t[2].m_arguments) == 1.5);
+    REQUIRE(std::get<1>(t[2].m_arguments) == "c");
+  }
+  SECTION("Columns.") {
+    auto t = ColumnarTrial<Sample<int, double, char>>();
+    t.insert({ 1, { 0.5, 'a' } });
+    t.insert({ 6, { 0.0, 'b' } });
+    t.insert({ 5, { 0.3, 'd' } });
+    REQUIRE(t.get_results() == std::vector<int>{ 1, 6, 5 });
+    REQUIRE(t.get_arguments<0>() == std::vector<double>{ 0.5, 0.0, 0.3 });
+    REQUIRE(t.get_arguments<1>() == std::vector<char>{ 'a', 'b', 'd' });
+  }
+  SECTION("Iterators.") {
+    auto t = ColumnarTrial<Sample<int, double, char>>();
+    t.insert({ 1, { 0.5, 'a' } });
+    t.insert({ 6, { 0.0, 'b' } });
+    auto results = std::vector<int>();
+    for(auto i = t.begin(); i != t.end(); ++i) {
+      results.push_back(i->m_result);
+    }
+    REQUIRE(results == std::vector<int>{ 1, 6 });
+    auto v = TrialView(t);
+    REQUIRE(v.size() == 2);
+    REQUIRE(v[1].m_result == 6);
+    REQUIRE(std::get<1>(v[1].m_arguments) == 'b');
+  }
+}
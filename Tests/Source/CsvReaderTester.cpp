@@ -0,0 +1,134 @@
+#include <sstream>
+#include <string>
+#include <catch2/catch.hpp>
+#include "Rover/CsvParser.hpp"
+#include "Rover/CsvReader.hpp"
+#include "Rover/ListTrial.hpp"
+#include "Rover/Sample.hpp"
+
+using namespace Rover;
+
+namespace {
+  template<typename Sample>
+  std::vector<Sample> read_all(const std::string& csv,
+      std::size_t buffer_size) {
+    auto stream = std::istringstream(csv);
+    auto reader = CsvReader(stream, buffer_size);
+    auto samples = std::vector<Sample>();
+    auto sample = Sample();
+    while(!reader.is_exhausted()) {
+      if(reader.read(sample)) {
+        samples.push_back(sample);
+      }
+    }
+    return samples;
+  }
+
+  template<typename Sample>
+  std::vector<Sample> read_with_stream(const std::string& csv) {
+    auto stream = std::istringstream(csv);
+    auto samples = std::vector<Sample>();
+    while(stream.good()) {
+      auto sample = Sample();
+      stream >> sample;
+      if(stream.good()) {
+        samples.push_back(sample);
+      }
+    }
+    return samples;
+  }
+
+  template<typename Sample>
+  auto flatten(const Sample& sample) {
+    return std::tuple_cat(std::tuple(sample.m_result), sample.m_arguments);
+  }
+
+  template<typename Sample>
+  auto flatten(const std::vector<Sample>& samples) {
+    auto result = std::vector<decltype(flatten(samples.front()))>();
+    for(auto& sample : samples) {
+      result.push_back(flatten(sample));
+    }
+    return result;
+  }
+}
+
+TEST_CASE("test_csv_reader_fields", "[CsvReader]") {
+  using TestSample = Sample<std::string, int, std::string>;
+  auto inputs = std::vector<std::string>{
+    "",
+    "a,1,b\n",
+    "a,1,b\nc,2,d\n",
+    "a,1,b\nc,2,d",
+    "\"a\",1,\"b\"\n",
+    "\",a,\",5,\"\"\",\"\",\"\n\",\"\",\",75,\"\"\"abc\"\",\"\"qwe\"\"\"\n",
+    "\"multi\nline\",3,\"\"\n",
+    "x,4,\"unterminated",
+    "a,1,b\0c,2,d\0",
+    "a\"b,1,c\"\"d\n",
+    ",,\n",
+    "a, 7 ,b\n",
+    "a,+7,b\n",
+    "a,-7,b\n",
+    "long field of many characters without delimiters,12345678,"
+      "another long field with \"\"quotes\"\" inside\n"
+  };
+  for(auto& input : inputs) {
+    auto expected = read_with_stream<TestSample>(input);
+    for(auto buffer_size : { 1, 2, 3, 7, 64, 65536 }) {
+      REQUIRE(flatten(read_all<TestSample>(input, buffer_size)) ==
+        flatten(expected));
+    }
+  }
+}
+
+TEST_CASE("test_csv_reader_numbers", "[CsvReader]") {
+  using TestSample = Sample<double, int, unsigned long long, float, char,
+    bool>;
+  auto inputs = std::vector<std::string>{
+    "0.5,1,2,3.25,a,1\n",
+    "-1e-300,-2147483648,18446744073709551615,1e30,z,0\n",
+    "0.1,0,0,0.1, q,1\n3.14159265358979,42,7,-0.5,x,0\n",
+    "1.7976931348623157e308,2147483647,0,1.5e-45,b,1\n"
+  };
+  for(auto& input : inputs) {
+    auto expected = read_with_stream<TestSample>(input);
+    REQUIRE(!expected.empty());
+    REQUIRE(flatten(read_all<TestSample>(input, 5)) == flatten(expected));
+  }
+}
+
+TEST_CASE("test_csv_reader_errors", "[CsvReader]") {
+  using TestSample = Sample<int, int>;
+  SECTION("Invalid numbers.") {
+    auto samples = read_all<TestSample>("1,2\nx,3\n4,y\n5,6\n", 4);
+    REQUIRE(flatten(samples) == flatten(std::vector<TestSample>{
+      { 1, { 2 } }, { 5, { 6 } } }));
+  }
+  SECTION("Text after a closing quote.") {
+    auto samples = read_all<TestSample>("\"1\"x,2\n3,4\n", 4);
+    REQUIRE(flatten(samples) == flatten(std::vector<TestSample>{
+      { 3, { 4 } } }));
+  }
+  SECTION("Empty numbers.") {
+    auto samples = read_all<TestSample>(",\n", 4);
+    REQUIRE(flatten(samples) == flatten(std::vector<TestSample>{
+      { 0, { 0 } } }));
+  }
+}
+
+TEST_CASE("test_csv_reader_round_trip", "[CsvReader]") {
+  auto trial = ListTrial<Sample<double, int, std::string>>();
+  for(auto i = 0; i != 1000; ++i) {
+    trial.insert({ 0.25 * i - 7, { i * 1000 - 5, i % 3 == 0 ?
+      "\"quoted\", text\n" : std::to_string(i) } });
+  }
+  auto stream = std::stringstream();
+  save_to_csv(trial, stream);
+  auto loaded = ListTrial<Sample<double, int, std::string>>();
+  load_from_csv(stream, loaded);
+  REQUIRE(loaded.size() == trial.size());
+  for(auto i = std::size_t(0); i != trial.size(); ++i) {
+    REQUIRE(flatten(loaded[i]) == flatten(trial[i]));
+  }
+}
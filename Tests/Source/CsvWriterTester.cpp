@@ -0,0 +1,129 @@
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <catch2/catch.hpp>
+#include "Rover/CsvParser.hpp"
+#include "Rover/CsvWriter.hpp"
+#include "Rover/ListTrial.hpp"
+#include "Rover/Sample.hpp"
+
+using namespace Rover;
+
+namespace {
+  template<typename Sample>
+  std::string write_all(const std::vector<Sample>& samples,
+      std::size_t buffer_size) {
+    auto stream = std::ostringstream();
+    {
+      auto writer = CsvWriter(stream, buffer_size);
+      for(auto& sample : samples) {
+        writer.write(sample);
+      }
+    }
+    return stream.str();
+  }
+
+  template<typename Sample>
+  std::string write_with_stream(const std::vector<Sample>& samples) {
+    auto stream = std::ostringstream();
+    for(auto& sample : samples) {
+      stream << sample << '\n';
+    }
+    return stream.str();
+  }
+
+  template<typename T>
+  bool is_identical(T left, T right) {
+    return std::memcmp(&left, &right, sizeof(T)) == 0 ||
+      (std::isnan(left) && std::isnan(right));
+  }
+}
+
+TEST_CASE("test_csv_writer_fields", "[CsvWriter]") {
+  SECTION("Integers and strings.") {
+    using TestSample = Sample<std::string, int, std::string, char, bool,
+      unsigned long long>;
+    auto samples = std::vector<TestSample>{
+      { "abc", { 7, "", 'x', true, 0 } },
+      { ",a,", { -5, "\",\",", ',', false,
+        std::numeric_limits<unsigned long long>::max() } },
+      { "\"abc\",\"qwe\"", { std::numeric_limits<int>::min(), "multi\nline",
+        '"', true, 1 } },
+      { std::string(300, 'z'), { 0, std::string(200, '"'), '\n', false,
+        42 } },
+      { std::string("a\0b", 3), { 1, std::string(1, '\0'), '\0', true,
+        2 } }
+    };
+    auto expected = write_with_stream(samples);
+    for(auto buffer_size : { 1, 64, 100, 65536 }) {
+      REQUIRE(write_all(samples, buffer_size) == expected);
+    }
+  }
+  SECTION("Save to CSV.") {
+    auto trial = ListTrial<Sample<int, int, std::string>>();
+    trial.insert({ 5, { 7, "abc" } });
+    trial.insert({ -1, { 3, "a,b" } });
+    auto stream = std::ostringstream();
+    save_to_csv(trial, stream);
+    REQUIRE(stream.str() == "5,7,abc\n-1,3,\"a,b\"\n");
+  }
+}
+
+TEST_CASE("test_csv_writer_string_round_trip", "[CsvWriter]") {
+  using TestSample = Sample<std::string, std::string, char>;
+  auto trial = ListTrial<TestSample>();
+  trial.insert({ std::string("a\0b", 3), { "x,\"y\"\nz", '\0' } });
+  trial.insert({ std::string(1, '\0'), { std::string(2, '\0'), ',' } });
+  trial.insert({ "plain", { "", 'c' } });
+  auto stream = std::stringstream();
+  save_to_csv(trial, stream);
+  auto loaded = ListTrial<TestSample>();
+  load_from_csv(stream, loaded);
+  REQUIRE(loaded.size() == trial.size());
+  for(auto i = std::size_t(0); i != trial.size(); ++i) {
+    REQUIRE(loaded[i].m_result == trial[i].m_result);
+    REQUIRE(loaded[i].m_arguments == trial[i].m_arguments);
+  }
+}
+
+TEST_CASE("test_csv_writer_round_trip", "[CsvWriter]") {
+  using TestSample = Sample<double, float, double>;
+  auto engine = std::mt19937_64(5);
+  auto trial = ListTrial<TestSample>();
+  auto special = std::vector<double>{ 0., -0., 0.1, 1. / 3, 1E300, -1E-300,
+    std::numeric_limits<double>::min(), std::numeric_limits<double>::max(),
+    std::numeric_limits<double>::denorm_min(),
+    std::numeric_limits<double>::infinity(),
+    -std::numeric_limits<double>::infinity() };
+  for(auto value : special) {
+    trial.insert({ value, { static_cast<float>(value), -value } });
+  }
+  for(auto i = 0; i != 10000; ++i) {
+    auto bits = engine();
+    auto value = double();
+    std::memcpy(&value, &bits, sizeof(value));
+    auto float_bits = static_cast<std::uint32_t>(engine());
+    auto float_value = float();
+    std::memcpy(&float_value, &float_bits, sizeof(float_value));
+    if(std::isnan(value) || std::isnan(float_value)) {
+      continue;
+    }
+    trial.insert({ value, { float_value, std::ldexp(value, -700) } });
+  }
+  auto stream = std::stringstream();
+  save_to_csv(trial, stream);
+  auto loaded = ListTrial<TestSample>();
+  load_from_csv(stream, loaded);
+  REQUIRE(loaded.size() == trial.size());
+  for(auto i = std::size_t(0); i != trial.size(); ++i) {
+    REQUIRE(is_identical(loaded[i].m_result, trial[i].m_result));
+    REQUIRE(is_identical(std::get<0>(loaded[i].m_arguments),
+      std::get<0>(trial[i].m_arguments)));
+    REQUIRE(is_identical(std::get<1>(loaded[i].m_arguments),
+      std::get<1>(trial[i].m_arguments)));
+  }
+}
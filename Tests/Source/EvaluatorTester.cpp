@@ -0,0 +1,337 @@
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Constant.hpp"
+#include "Rover/Evaluator.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/Lift.hpp"
+#include "Rover/Range.hpp"
+
+using namespace Rover;
+
+namespace {
+  class Counter {
+    public:
+      using Type = int;
+
+      Type generate(Evaluator& evaluator) {
+        return m_count++;
+      }
+
+    private:
+      int m_count = 0;
+  };
+
+  template<typename G>
+  class Sum {
+    public:
+      using Type = int;
+
+      explicit Sum(std::vector<G*> children)
+        : m_children(std::move(children)) {}
+
+      Type generate(Evaluator& evaluator) {
+        auto sum = 0;
+        for(auto child : m_children) {
+          sum += evaluator.evaluate(*child);
+        }
+        return sum;
+      }
+
+    private:
+      std::vector<G*> m_children;
+  };
+
+  class CountingResource : public std::pmr::memory_resource {
+    public:
+      std::size_t get_allocations() const {
+        return m_allocations;
+      }
+
+    private:
+      std::size_t m_allocations = 0;
+
+      void* do_allocate(std::size_t size, std::size_t alignment) override {
+        ++m_allocations;
+        return std::pmr::new_delete_resource()->allocate(size, alignment);
+      }
+
+      void do_deallocate(void* pointer, std::size_t size,
+          std::size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(pointer, size, alignment);
+      }
+
+      bool do_is_equal(const std::pmr::memory_resource& other) const
+          noexcept override {
+        return this == &other;
+      }
+  };
+
+  struct Tally {
+    using Type = int;
+
+    Counter m_counter;
+    int m_count = 0;
+
+    Type generate(Evaluator& evaluator) {
+      return 100 + m_count++;
+    }
+  };
+}
+
+TEST_CASE("test_memoization", "[Evaluator]") {
+  SECTION("Same generator.") {
+    auto counter = Counter();
+    auto evaluator = Evaluator();
+    REQUIRE(evaluator.evaluate(counter) == 0);
+    REQUIRE(evaluator.evaluate(counter) == 0);
+    REQUIRE(generate(counter) == 1);
+  }
+  SECTION("Distinct generators.") {
+    auto first = Counter();
+    auto second = Counter();
+    auto evaluator = Evaluator();
+    REQUIRE(evaluator.evaluate(first) == 0);
+    REQUIRE(evaluator.evaluate(second) == 0);
+    REQUIRE(evaluator.evaluate(first) == 0);
+  }
+  SECTION("Same address, different types.") {
+    auto tally = Tally();
+    REQUIRE(static_cast<void*>(&tally) ==
+      static_cast<void*>(&tally.m_counter));
+    auto evaluator = Evaluator();
+    REQUIRE(evaluator.evaluate(tally.m_counter) == 0);
+    REQUIRE(evaluator.evaluate(tally) == 100);
+    REQUIRE(evaluator.evaluate(tally.m_counter) == 0);
+    REQUIRE(evaluator.evaluate(tally) == 100);
+    REQUIRE(generate(tally) == 101);
+    REQUIRE(generate(tally.m_counter) == 1);
+  }
+}
+
+TEST_CASE("test_large_graph", "[Evaluator]") {
+  auto counters = std::vector<Counter>(1000);
+  auto children = std::vector<Counter*>();
+  for(auto& counter : counters) {
+    children.push_back(&counter);
+    children.push_back(&counter);
+  }
+  auto sum = Sum(children);
+  auto evaluator = Evaluator();
+  REQUIRE(evaluator.evaluate(sum) == 0);
+  for(auto& counter : counters) {
+    REQUIRE(evaluator.evaluate(counter) == 0);
+  }
+  REQUIRE(generate(sum) == 2000);
+  REQUIRE(generate(sum) == 4000);
+}
+
+TEST_CASE("test_reset", "[Evaluator]") {
+  SECTION("New session.") {
+    auto counter = Counter();
+    auto evaluator = Evaluator();
+    REQUIRE(evaluator.evaluate(counter) == 0);
+    REQUIRE(evaluator.evaluate(counter) == 0);
+    evaluator.reset();
+    REQUIRE(evaluator.evaluate(counter) == 1);
+    REQUIRE(generate(counter, evaluator) == 2);
+    REQUIRE(evaluator.evaluate(counter) == 2);
+  }
+  SECTION("Destroys values.") {
+    auto text = Lift([] {
+      return std::string(100, 'a');
+    });
+    auto evaluator = Evaluator();
+    for(auto i = 0; i < 100; ++i) {
+      REQUIRE(generate(text, evaluator).size() == 100);
+    }
+  }
+}
+
+TEST_CASE("test_steady_state_allocation", "[Evaluator]") {
+  auto resource = CountingResource();
+  auto evaluator = Evaluator(&resource);
+  auto r1 = Range(0, 100);
+  auto r2 = Range(0., 1.);
+  auto counters = std::vector<Counter>(500);
+  auto children = std::vector<Counter*>();
+  for(auto& counter : counters) {
+    children.push_back(&counter);
+  }
+  auto generator = Lift([](int a, double b, int c) {
+    return std::make_tuple(a, b, c);
+  }, &r1, &r2, Sum(children));
+  generate(generator, evaluator);
+  auto allocations = resource.get_allocations();
+  REQUIRE(allocations != 0);
+  for(auto i = 0; i < 100000; ++i) {
+    generate(generator, evaluator);
+  }
+  REQUIRE(resource.get_allocations() == allocations);
+}
+
+TEST_CASE("test_static_tree", "[Evaluator]") {
+  SECTION("Traits.") {
+    static_assert(is_static_tree_v<Constant<int>>);
+    static_assert(is_static_tree_v<Range<int, int>>);
+    static_assert(is_static_tree_v<decltype(Lift(std::plus<>(), Range(0, 1),
+      Constant(2)))>);
+    static_assert(!is_static_tree_v<Counter>);
+    static_assert(!is_static_tree_v<decltype(Lift(std::negate<>(),
+      std::declval<Range<int, int>*>()))>);
+    static_assert(!is_static_tree_v<Range<Counter, int>>);
+  }
+  SECTION("Root memoized.") {
+    auto lift = Lift([](double x, double y) {
+      return x + y;
+    }, Range(0., 1.), Range(0., 1.));
+    auto evaluator = Evaluator();
+    auto first = evaluator.evaluate(lift);
+    REQUIRE(evaluator.evaluate(lift) == first);
+    evaluator.reset();
+    REQUIRE(evaluator.evaluate(lift) != first);
+  }
+  SECTION("Shared root.") {
+    auto range = Range(0, 1000000);
+    auto first = Lift([](int x) {
+      return x;
+    }, &range);
+    auto second = Lift([](int x) {
+      return -x;
+    }, &range);
+    auto sum = Lift([](int x, int y) {
+      return x + y;
+    }, &first, &second);
+    for(auto i = 0; i < 100; ++i) {
+      REQUIRE(generate(sum) == 0);
+    }
+  }
+  SECTION("Nested non-static.") {
+    auto counter = Counter();
+    auto tree = Lift([](int x, int y) {
+      return x + y;
+    }, Lift([](int x) {
+      return x;
+    }, &counter), Lift([](int x) {
+      return x;
+    }, &counter));
+    auto evaluator = Evaluator();
+    REQUIRE(evaluator.evaluate(tree) == 0);
+    evaluator.reset();
+    REQUIRE(evaluator.evaluate(tree) == 2);
+  }
+}
+
+TEST_CASE("test_profile", "[Evaluator]") {
+  auto counter = Counter();
+  auto sum = Sum<Counter>({&counter, &counter});
+  auto evaluator = Evaluator();
+  evaluator.evaluate(sum);
+  evaluator.reset();
+  evaluator.evaluate(sum);
+  auto profile = evaluator.profile();
+#ifdef ROVER_ENABLE_PROFILING
+  REQUIRE(profile.size() == 2);
+  auto& sum_profile = profile[0];
+  auto& counter_profile = profile[1];
+  REQUIRE(sum_profile.m_identity == &sum);
+  REQUIRE(*sum_profile.m_type == typeid(Sum<Counter>));
+  REQUIRE(sum_profile.m_evaluations == 2);
+  REQUIRE(sum_profile.m_hits == 0);
+  REQUIRE(sum_profile.m_misses == 2);
+  REQUIRE(counter_profile.m_identity == &counter);
+  REQUIRE(counter_profile.m_evaluations == 4);
+  REQUIRE(counter_profile.m_hits == 2);
+  REQUIRE(counter_profile.m_misses == 2);
+  REQUIRE(sum_profile.m_total_time >= counter_profile.m_total_time);
+  REQUIRE(sum_profile.m_self_time <= sum_profile.m_total_time);
+  REQUIRE(sum_profile.m_total_time - sum_profile.m_self_time ==
+    counter_profile.m_total_time);
+  SECTION("Static tree.") {
+    auto lift = Lift([](int value) {
+      return 2 * value;
+    }, Range(0, 10));
+    evaluator.reset_profile();
+    evaluator.evaluate(lift);
+    auto profile = evaluator.profile();
+    REQUIRE(profile.size() == 4);
+    REQUIRE(profile[0].m_identity == &lift);
+    for(auto& generator_profile : profile) {
+      REQUIRE(generator_profile.m_evaluations == 1);
+      REQUIRE(generator_profile.m_misses == 1);
+    }
+  }
+  SECTION("Reset.") {
+    evaluator.reset_profile();
+    REQUIRE(evaluator.profile().empty());
+  }
+#else
+  REQUIRE(profile.empty());
+#endif
+}
+
+TEST_CASE("test_invalidate", "[Evaluator]") {
+  auto evaluator = Evaluator();
+  evaluator.set_dependency_tracking(true);
+  SECTION("Affected generators.") {
+    auto c1 = Counter();
+    auto c2 = Counter();
+    auto s1 = Sum<Counter>({&c1});
+    auto s2 = Sum<Counter>({&c2});
+    auto top = Sum<Sum<Counter>>({&s1, &s2});
+    REQUIRE(evaluator.evaluate(top) == 0);
+    evaluator.invalidate(c1);
+    REQUIRE(evaluator.evaluate(top) == 1);
+    REQUIRE(evaluator.evaluate(s1) == 1);
+    REQUIRE(evaluator.evaluate(s2) == 0);
+    evaluator.invalidate(c1);
+    evaluator.invalidate(c1);
+    REQUIRE(evaluator.evaluate(s1) == 2);
+    REQUIRE(evaluator.evaluate(top) == 2);
+  }
+  SECTION("Dependent only.") {
+    auto counter = Counter();
+    auto sum = Sum<Counter>({&counter, &counter});
+    REQUIRE(evaluator.evaluate(sum) == 0);
+    evaluator.invalidate(sum);
+    REQUIRE(evaluator.evaluate(sum) == 0);
+    REQUIRE(evaluator.evaluate(counter) == 0);
+  }
+  SECTION("Ranges.") {
+    auto r1 = Range(0, 1000000);
+    auto r2 = Range(0, 1000000);
+    auto lift = Lift([](int a, int b) {
+      return std::make_tuple(a, b);
+    }, &r1, &r2);
+    auto [a1, b1] = evaluator.evaluate(lift);
+    auto changed = false;
+    for(auto i = 0; i < 10; ++i) {
+      evaluator.invalidate(r1);
+      auto [a2, b2] = evaluator.evaluate(lift);
+      REQUIRE(b2 == b1);
+      REQUIRE(a2 == evaluator.evaluate(r1));
+      changed = changed || a2 != a1;
+    }
+    REQUIRE(changed);
+  }
+  SECTION("Unknown generator.") {
+    auto counter = Counter();
+    evaluator.invalidate(counter);
+    REQUIRE(evaluator.evaluate(counter) == 0);
+    REQUIRE(evaluator.evaluate(counter) == 0);
+  }
+  SECTION("Untracked.") {
+    auto counter = Counter();
+    auto sum = Sum<Counter>({&counter});
+    REQUIRE(evaluator.evaluate(sum) == 0);
+    evaluator.set_dependency_tracking(false);
+    REQUIRE(!evaluator.is_tracking_dependencies());
+    REQUIRE(evaluator.evaluate(sum) == 1);
+    evaluator.invalidate(counter);
+    REQUIRE(evaluator.evaluate(counter) == 2);
+    REQUIRE(evaluator.evaluate(sum) == 1);
+  }
+}
@@ -0,0 +1,46 @@
+#include <iterator>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Batch.hpp"
+#include "Rover/Constant.hpp"
+#include "Rover/Exponential.hpp"
+#include "Rover/Generator.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_exponential", "[Exponential]") {
+  auto scope = SeedScope(37);
+  SECTION("Generate.") {
+    auto exponential = Exponential(4);
+    auto sum = 0.;
+    for(auto i = 0; i < 100000; ++i) {
+      auto value = generate(exponential);
+      REQUIRE(value >= 0);
+      sum += value;
+    }
+    REQUIRE(sum / 100000 == Approx(0.25).epsilon(0.02));
+  }
+  SECTION("Batch.") {
+    REQUIRE(is_batchable_v<Exponential<Constant<double>>>);
+    auto exponential = Exponential(0.5);
+    auto values = std::vector<double>();
+    generate_batch(exponential, 100001, std::back_inserter(values));
+    REQUIRE(values.size() == 100001);
+    auto sum = 0.;
+    auto tail = 0;
+    for(auto value : values) {
+      REQUIRE(value >= 0);
+      sum += value;
+      tail += value > 2;
+    }
+    REQUIRE(sum / values.size() == Approx(2).epsilon(0.02));
+    REQUIRE(tail / 100001. == Approx(0.3679).epsilon(0.02));
+  }
+  SECTION("Transform.") {
+    auto exponential = Exponential(2.);
+    auto evaluator = Evaluator();
+    REQUIRE(exponential.transform(evaluator, 0) == 0);
+    REQUIRE(exponential.transform(evaluator, 0.5) ==
+      Approx(0.34657359027997264));
+  }
+}
@@ -0,0 +1,177 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <catch2/catch.hpp>
+#include "Rover/CsvParser.hpp"
+#include "Rover/FileTrial.hpp"
+#include "Rover/ListTrial.hpp"
+#include "Rover/Sample.hpp"
+#include "Rover/TrialView.hpp"
+
+using namespace Rover;
+
+namespace {
+  const auto PATH = "file_trial_tester.bin";
+  using TestSample = Sample<double, int, char>;
+
+  TestSample make_sample(int i) {
+    return { 0.5 * i, { i, static_cast<char>('a' + i % 26) } };
+  }
+}
+
+TEST_CASE("test_file_trial_insert", "[FileTrial]") {
+  std::remove(PATH);
+  SECTION("Empty trial.") {
+    auto trial = FileTrial<TestSample>(PATH, 3);
+    REQUIRE(trial.size() == 0);
+    REQUIRE(trial.begin() == trial.end());
+    REQUIRE(trial.chunk_size() == 3);
+  }
+  SECTION("Random access.") {
+    auto trial = FileTrial<TestSample>(PATH, 3, 2);
+    for(auto i = 0; i != 20; ++i) {
+      trial.insert(make_sample(i));
+      REQUIRE(trial.size() == static_cast<std::size_t>(i + 1));
+    }
+    for(auto i : { 19, 0, 7, 18, 3, 12, 5 }) {
+      REQUIRE(trial[i].m_result == 0.5 * i);
+      REQUIRE(std::get<0>(trial[i].m_arguments) == i);
+      REQUIRE(std::get<1>(trial[i].m_arguments) == 'a' + i % 26);
+    }
+    auto statistics = trial.get_cache_statistics();
+    REQUIRE(statistics.m_misses > 0);
+    REQUIRE(statistics.m_evictions > 0);
+  }
+  SECTION("Trial compatibility.") {
+    auto list = ListTrial<TestSample>();
+    auto trial = FileTrial<TestSample>(PATH, 4);
+    for(auto i = 0; i != 10; ++i) {
+      list.insert(make_sample(i));
+    }
+    trial.insert(list.begin(), list.end());
+    auto expected = std::ostringstream();
+    save_to_csv(list, expected);
+    auto actual = std::ostringstream();
+    save_to_csv(trial, actual);
+    REQUIRE(actual.str() == expected.str());
+    auto view = TrialView(trial);
+    REQUIRE(view.size() == 10);
+    REQUIRE(view[9].m_result == 4.5);
+  }
+  std::remove(PATH);
+}
+
+TEST_CASE("test_file_trial_persistence", "[FileTrial]") {
+  std::remove(PATH);
+  SECTION("Reopen.") {
+    {
+      auto trial = FileTrial<TestSample>(PATH, 3);
+      for(auto i = 0; i != 7; ++i) {
+        trial.insert(make_sample(i));
+      }
+    }
+    {
+      auto trial = FileTrial<TestSample>(PATH, 100);
+      REQUIRE(trial.size() == 7);
+      REQUIRE(trial.chunk_size() == 3);
+      for(auto i = 7; i != 11; ++i) {
+        trial.insert(make_sample(i));
+      }
+    }
+    auto trial = FileTrial<TestSample>(PATH);
+    REQUIRE(trial.size() == 11);
+    for(auto i = 0; i != 11; ++i) {
+      REQUIRE(std::get<0>(trial[i].m_arguments) == i);
+    }
+  }
+  SECTION("Missing footer.") {
+    {
+      auto trial = FileTrial<TestSample>(PATH, 3);
+      for(auto i = 0; i != 9; ++i) {
+        trial.insert(make_sample(i));
+      }
+    }
+    std::filesystem::resize_file(PATH, std::filesystem::file_size(PATH) - 1);
+    auto trial = FileTrial<TestSample>(PATH);
+    REQUIRE(trial.size() == 9);
+    REQUIRE(std::get<0>(trial[8].m_arguments) == 8);
+    trial.insert(make_sample(9));
+    trial.flush();
+    auto reopened = FileTrial<TestSample>(PATH);
+    REQUIRE(reopened.size() == 10);
+  }
+  SECTION("Footer written on flush.") {
+    const auto chunk_bytes = sizeof(Details::ChunkHeader) +
+      2 * sizeof(TestSample);
+    {
+      auto trial = FileTrial<TestSample>(PATH, 2);
+      for(auto i = 0; i != 20; ++i) {
+        trial.insert(make_sample(i));
+      }
+      REQUIRE(std::filesystem::file_size(PATH) ==
+        BINARY_DATA_OFFSET + 10 * chunk_bytes);
+      trial.flush();
+      REQUIRE(std::filesystem::file_size(PATH) ==
+        BINARY_DATA_OFFSET + 10 * chunk_bytes +
+        10 * sizeof(Details::ChunkIndexEntry) + sizeof(Details::ChunkFooter));
+    }
+    const auto copy_path = "file_trial_tester_copy.bin";
+    {
+      auto trial = FileTrial<TestSample>(PATH);
+      for(auto i = 20; i != 24; ++i) {
+        trial.insert(make_sample(i));
+      }
+      std::filesystem::copy_file(PATH, copy_path,
+        std::filesystem::copy_options::overwrite_existing);
+    }
+    {
+      auto trial = FileTrial<TestSample>(copy_path);
+      REQUIRE(trial.size() == 24);
+      for(auto i = 0; i != 24; ++i) {
+        REQUIRE(std::get<0>(trial[i].m_arguments) == i);
+      }
+    }
+    std::remove(copy_path);
+  }
+  SECTION("Damaged chunk.") {
+    auto size = std::uintmax_t(0);
+    {
+      auto trial = FileTrial<TestSample>(PATH, 3);
+      for(auto i = 0; i != 6; ++i) {
+        trial.insert(make_sample(i));
+      }
+      size = std::filesystem::file_size(PATH);
+      for(auto i = 6; i != 9; ++i) {
+        trial.insert(make_sample(i));
+      }
+    }
+    {
+      auto file = std::fstream(PATH,
+        std::ios::binary | std::ios::in | std::ios::out);
+      file.seekp(size);
+      file.put('x');
+    }
+    {
+      auto trial = FileTrial<TestSample>(PATH);
+      REQUIRE(trial.size() == 9);
+      REQUIRE(std::get<0>(trial[5].m_arguments) == 5);
+      REQUIRE_THROWS_AS(trial[6], std::runtime_error);
+    }
+    std::filesystem::resize_file(PATH, std::filesystem::file_size(PATH) - 1);
+    auto trial = FileTrial<TestSample>(PATH);
+    REQUIRE(trial.size() == 6);
+    REQUIRE(std::get<0>(trial[5].m_arguments) == 5);
+  }
+  SECTION("Errors.") {
+    {
+      auto trial = FileTrial<TestSample>(PATH);
+    }
+    REQUIRE_THROWS_AS((FileTrial<Sample<double, float>>(PATH)),
+      std::runtime_error);
+    std::ofstream(PATH, std::ios::binary) << "5,7";
+    REQUIRE_THROWS_AS(FileTrial<TestSample>(PATH), std::runtime_error);
+  }
+  std::remove(PATH);
+}
@@ -1,9 +1,15 @@
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <vector>
 #include <catch2/catch.hpp>
+#include "Rover/Batch.hpp"
 #include "Rover/Constant.hpp"
 #include "Rover/Filter.hpp"
 #include "Rover/Generator.hpp"
 #include "Rover/Lift.hpp"
 #include "Rover/Pick.hpp"
+#include "Rover/Range.hpp"
 
 using namespace Rover;
 
@@ -61,3 +67,60 @@ TEST_CASE("test_stacked_filters", "[Filter]") {
   REQUIRE(generate(filter2) == 8);
   REQUIRE(generate(filter2) == 9);
 }
+
+TEST_CASE("test_filter_statistics", "[Filter]") {
+  SECTION("Acceptance rate.") {
+    auto filter = Filter([](auto x) {
+        return x < 10;
+      }, Range(0, 99));
+    REQUIRE(filter.acceptance_rate() == 1.);
+    for(auto i = 0; i < 1000; ++i) {
+      REQUIRE(generate(filter) < 10);
+    }
+    REQUIRE(filter.acceptances() == 1000);
+    REQUIRE(filter.attempts() > 5000);
+    REQUIRE(filter.acceptance_rate() > 0.05);
+    REQUIRE(filter.acceptance_rate() < 0.2);
+  }
+  SECTION("Max attempts.") {
+    auto filter = Filter([](auto x) {
+        return x < 0;
+      }, Range(0, 99), 50);
+    REQUIRE(filter.get_max_attempts() == 50);
+    REQUIRE_THROWS_AS(generate(filter), std::runtime_error);
+    REQUIRE(filter.attempts() == 50);
+    filter.set_max_attempts(10);
+    REQUIRE_THROWS_AS(generate(filter), std::runtime_error);
+    REQUIRE(filter.attempts() == 60);
+  }
+  SECTION("Copy.") {
+    auto i = 0;
+    auto filter = Filter([](auto x) {
+        return x % 4 < 2;
+      }, Lift([&] {
+        return i++;
+      }));
+    for(auto j = 0; j < 21; ++j) {
+      generate(filter);
+    }
+    auto copy = filter;
+    auto values = std::set<int>();
+    for(auto j = 0; j < 50; ++j) {
+      values.insert(generate(filter));
+      values.insert(generate(copy));
+    }
+    REQUIRE(values.size() == 100);
+  }
+  SECTION("Batch.") {
+    auto filter = Filter([](auto x) {
+        return x % 2 == 0;
+      }, Range(0, 99));
+    auto values = std::vector<int>();
+    generate_batch(filter, 100, std::back_inserter(values));
+    REQUIRE(values.size() == 100);
+    for(auto value : values) {
+      REQUIRE(value % 2 == 0);
+    }
+    REQUIRE(filter.acceptances() == 100);
+  }
+}
@@ -0,0 +1,95 @@
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Constant.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/Grid.hpp"
+#include "Rover/Range.hpp"
+#include "Rover/Select.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_range_enumeration", "[Grid]") {
+  auto evaluator = Evaluator();
+  SECTION("Integral.") {
+    auto range = Range(3, 7);
+    REQUIRE(range.size(evaluator) == 5);
+    REQUIRE(range.at(evaluator, 0) == 3);
+    REQUIRE(range.at(evaluator, 4) == 7);
+  }
+  SECTION("Exclusive.") {
+    auto range = Range(3, 7, Interval::OPEN);
+    REQUIRE(range.size(evaluator) == 3);
+    REQUIRE(range.at(evaluator, 0) == 4);
+    REQUIRE(range.at(evaluator, 2) == 6);
+  }
+  SECTION("Granular.") {
+    auto range = Range(0., 1., 0.25);
+    REQUIRE(range.size(evaluator) == 5);
+    REQUIRE(range.at(evaluator, 1) == 0.25);
+    REQUIRE(range.at(evaluator, 4) == 1.);
+  }
+}
+
+TEST_CASE("test_grid", "[Grid]") {
+  auto evaluator = Evaluator();
+  SECTION("Order.") {
+    auto grid = Grid(Range(0, 2), Select(std::vector<Constant<std::string>>{
+      std::string("a"), std::string("b")}));
+    REQUIRE(grid.size() == 6);
+    auto expected = std::vector<std::tuple<int, std::string>>{{0, "a"},
+      {0, "b"}, {1, "a"}, {1, "b"}, {2, "a"}, {2, "b"}};
+    for(auto& point : expected) {
+      REQUIRE(generate(grid) == point);
+    }
+    REQUIRE(grid.get_index() == 6);
+    REQUIRE(generate(grid) == expected[0]);
+    grid.seek(3);
+    REQUIRE(generate(grid) == expected[3]);
+  }
+  SECTION("Set.") {
+    auto grid = Grid(Select(std::set<int>{5, 1, 3}));
+    REQUIRE(grid.size() == 3);
+    REQUIRE(generate(grid) == std::tuple(1));
+    REQUIRE(generate(grid) == std::tuple(3));
+    REQUIRE(generate(grid) == std::tuple(5));
+  }
+  SECTION("Random access.") {
+    auto grid = Grid(Range(0, 999), Range(0, 999), Range(0, 999));
+    REQUIRE(grid.size() == 1000000000);
+    REQUIRE(grid.at(evaluator, 0) == std::tuple(0, 0, 0));
+    REQUIRE(grid.at(evaluator, 123456789) == std::tuple(123, 456, 789));
+    REQUIRE(grid.at(evaluator, 999999999) == std::tuple(999, 999, 999));
+  }
+  SECTION("Shards.") {
+    auto grid = Grid(Range(0, 6), Range(0., 1., 0.5));
+    REQUIRE(grid.size() == 21);
+    auto points = std::set<std::tuple<int, double>>();
+    auto total = std::uint64_t(0);
+    for(auto i = 0; i < 4; ++i) {
+      auto shard = grid.shard(i, 4);
+      REQUIRE((shard.size() == 5 || shard.size() == 6));
+      total += shard.size();
+      for(auto j = std::uint64_t(0); j < shard.size(); ++j) {
+        auto point = generate(shard);
+        REQUIRE(point == grid.at(evaluator, total - shard.size() + j));
+        points.insert(point);
+      }
+    }
+    REQUIRE(total == 21);
+    REQUIRE(points.size() == 21);
+  }
+  SECTION("Empty dimension.") {
+    REQUIRE_THROWS_AS(Grid(Range(0, 2), Select(std::vector<int>())),
+      std::invalid_argument);
+    REQUIRE_THROWS_AS(Grid(Range(3, 4, Interval::OPEN)),
+      std::invalid_argument);
+    REQUIRE_THROWS_AS(Grid(Range(1, 4, 5)), std::invalid_argument);
+  }
+  SECTION("Overflow.") {
+    REQUIRE_THROWS_AS(Grid(Range(0, 99999), Range(0, 99999),
+      Range(0, 99999), Range(0, 99999)), std::overflow_error);
+  }
+}
@@ -0,0 +1,84 @@
+#include <cmath>
+#include <tuple>
+#include <catch2/catch.hpp>
+#include "Rover/Generator.hpp"
+#include "Rover/Guided.hpp"
+#include "Rover/ListTrial.hpp"
+#include "Rover/Range.hpp"
+#include "Rover/Sample.hpp"
+
+using namespace Rover;
+
+namespace {
+  using TestSample = Sample<double, double>;
+  using TestTrial = ListTrial<TestSample>;
+
+  struct Identity {
+    double operator ()(const std::tuple<double>& arguments) const {
+      return std::get<0>(arguments);
+    }
+  };
+
+  struct Zero {
+    double operator ()(const std::tuple<double>& arguments) const {
+      return 0.;
+    }
+  };
+}
+
+TEST_CASE("test_guided_candidates", "[Guided]") {
+  SECTION("Single candidate.") {
+    auto guided = Guided([](const std::tuple<double, int>& candidate) {
+      return 0.;
+    }, 1, Range(0., 1.), Range(5, 10));
+    REQUIRE(guided.get_candidates() == 1);
+    for(auto i = 0; i < 100; ++i) {
+      auto [x, y] = generate(guided);
+      REQUIRE(x >= 0.);
+      REQUIRE(x <= 1.);
+      REQUIRE(y >= 5);
+      REQUIRE(y <= 10);
+    }
+  }
+  SECTION("Best candidate.") {
+    auto guided = Guided([](const std::tuple<int>& candidate) {
+      return static_cast<double>(std::get<0>(candidate));
+    }, 1000, Range(0, 9));
+    for(auto i = 0; i < 100; ++i) {
+      REQUIRE(std::get<0>(generate(guided)) == 9);
+    }
+    guided.set_candidates(0);
+    REQUIRE(guided.get_candidates() == 1);
+  }
+}
+
+TEST_CASE("test_guided_acquisition", "[Guided]") {
+  SECTION("Prediction.") {
+    auto model = Identity();
+    auto guided = Guided(Prediction(model), 64, Range(0., 1.));
+    auto sum = 0.;
+    for(auto i = 0; i < 100; ++i) {
+      sum += std::get<0>(generate(guided));
+    }
+    REQUIRE(sum / 100 > 0.9);
+  }
+  SECTION("Novelty.") {
+    auto trial = TestTrial();
+    auto guided = Guided(Novelty(trial), 64, Range(0., 1.));
+    REQUIRE(std::isinf(guided.get_acquisition()(std::tuple(0.5))));
+    trial.insert(TestSample{0., std::tuple(0.)});
+    for(auto i = 0; i < 100; ++i) {
+      REQUIRE(std::get<0>(generate(guided)) > 0.8);
+    }
+  }
+  SECTION("Residual.") {
+    auto model = Zero();
+    auto trial = TestTrial();
+    trial.insert(TestSample{0., std::tuple(0.1)});
+    trial.insert(TestSample{5., std::tuple(0.9)});
+    auto guided = Guided(Residual(model, trial), 64, Range(0., 1.));
+    for(auto i = 0; i < 100; ++i) {
+      REQUIRE(std::get<0>(generate(guided)) > 0.5);
+    }
+  }
+}
@@ -0,0 +1,83 @@
+#include <array>
+#include <tuple>
+#include <catch2/catch.hpp>
+#include "Rover/Generator.hpp"
+#include "Rover/Halton.hpp"
+#include "Rover/Range.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_halton_sequence", "[Halton]") {
+  SECTION("Radical inverse.") {
+    auto halton = Halton(Range(0., 1.), Range(0., 1.));
+    REQUIRE(generate(halton) == std::tuple(0., 0.));
+    REQUIRE(generate(halton) == std::tuple(.5, 1. / 3));
+    auto [x, y] = generate(halton);
+    REQUIRE(x == .25);
+    REQUIRE(y == Approx(2. / 3));
+    REQUIRE(halton.get_index() == 3);
+  }
+  SECTION("Intervals.") {
+    auto halton = Halton(Range(0, 3, Interval::OPEN), Range(0, 9, 3));
+    auto counts = std::array<int, 2>();
+    auto granules = std::array<int, 4>();
+    for(auto i = 0; i < 1000; ++i) {
+      auto [x, y] = generate(halton);
+      REQUIRE(x >= 1);
+      REQUIRE(x <= 2);
+      REQUIRE(y % 3 == 0);
+      ++counts[x - 1];
+      ++granules[y / 3];
+    }
+    REQUIRE(counts[0] == 500);
+    REQUIRE(granules[0] >= 245);
+    REQUIRE(granules[0] <= 255);
+    REQUIRE(granules[3] >= 245);
+    REQUIRE(granules[3] <= 255);
+  }
+  SECTION("Seek.") {
+    auto first = Halton(Range(0., 1.), Range(0., 1.), Range(0., 1.));
+    auto second = Halton(Range(0., 1.), Range(0., 1.), Range(0., 1.));
+    for(auto i = 0; i < 17; ++i) {
+      generate(first);
+    }
+    second.seek(17);
+    REQUIRE(generate(first) == generate(second));
+  }
+  SECTION("Stratification.") {
+    auto halton = Halton(Range(0., 1.), Range(0., 1.));
+    auto cells = std::array<int, 72>();
+    for(auto i = 0; i < 720; ++i) {
+      auto [x, y] = generate(halton);
+      ++cells[static_cast<int>(8 * x) * 9 + static_cast<int>(9 * y + 1E-9)];
+    }
+    for(auto cell : cells) {
+      REQUIRE(cell == 10);
+    }
+  }
+}
+
+TEST_CASE("test_halton_scrambling", "[Halton]") {
+  auto make = [](std::uint64_t seed) {
+    auto halton = Halton(Range(0., 1.), Range(0., 1.));
+    halton.scramble(seed);
+    return halton;
+  };
+  auto first = make(5);
+  auto second = make(5);
+  auto third = make(6);
+  auto differences = 0;
+  for(auto i = 0; i < 100; ++i) {
+    auto value = generate(first);
+    REQUIRE(value == generate(second));
+    if(value != generate(third)) {
+      ++differences;
+    }
+    auto [x, y] = value;
+    REQUIRE(x >= 0.);
+    REQUIRE(x < 1.);
+    REQUIRE(y >= 0.);
+    REQUIRE(y < 1.);
+  }
+  REQUIRE(differences > 90);
+}
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Generator.hpp"
+#include "Rover/LatinHypercube.hpp"
+#include "Rover/Range.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_feistel_permutation", "[LatinHypercube]") {
+  for(auto size : {1, 2, 3, 7, 16, 1000}) {
+    auto permutation = Details::FeistelPermutation(size, 42);
+    auto images = std::vector<std::uint64_t>();
+    for(auto i = 0; i < size; ++i) {
+      images.push_back(permutation(i));
+    }
+    std::sort(images.begin(), images.end());
+    auto expected = std::vector<std::uint64_t>(size);
+    std::iota(expected.begin(), expected.end(), std::uint64_t(0));
+    REQUIRE(images == expected);
+  }
+}
+
+TEST_CASE("test_latin_hypercube", "[LatinHypercube]") {
+  SECTION("Strata.") {
+    auto hypercube = LatinHypercube(100, Range(0., 1.), Range(0, 99),
+      Range(-10., 10.));
+    REQUIRE(hypercube.get_count() == 100);
+    for(auto plan = 0; plan < 3; ++plan) {
+      auto first = std::vector<int>();
+      auto second = std::vector<int>();
+      auto third = std::vector<int>();
+      for(auto i = 0; i < 100; ++i) {
+        auto [x, y, z] = generate(hypercube);
+        first.push_back(static_cast<int>(100 * x));
+        second.push_back(y);
+        third.push_back(static_cast<int>(5 * (z + 10)));
+      }
+      for(auto strata : {&first, &second, &third}) {
+        std::sort(strata->begin(), strata->end());
+        for(auto i = 0; i < 100; ++i) {
+          REQUIRE((*strata)[i] == i);
+        }
+      }
+    }
+  }
+  SECTION("Plans differ.") {
+    auto hypercube = LatinHypercube(50, Range(0, 49));
+    auto first = std::vector<int>();
+    auto second = std::vector<int>();
+    for(auto i = 0; i < 50; ++i) {
+      first.push_back(std::get<0>(generate(hypercube)));
+    }
+    for(auto i = 0; i < 50; ++i) {
+      second.push_back(std::get<0>(generate(hypercube)));
+    }
+    REQUIRE(first != second);
+  }
+  SECTION("Seek.") {
+    auto hypercube = LatinHypercube(10, Range(0, 9));
+    auto values = std::vector<int>();
+    for(auto i = 0; i < 10; ++i) {
+      values.push_back(std::get<0>(generate(hypercube)));
+    }
+    hypercube.seek(4);
+    REQUIRE(hypercube.get_index() == 4);
+  }
+  SECTION("Empty plan.") {
+    REQUIRE_THROWS_AS(LatinHypercube(0, Range(0, 9)), std::invalid_argument);
+  }
+  SECTION("Large plan.") {
+    auto hypercube = LatinHypercube(10000000, Range(0., 1.));
+    for(auto i = 0; i < 1000; ++i) {
+      auto [x] = generate(hypercube);
+      REQUIRE(x >= 0.);
+      REQUIRE(x <= 1.);
+    }
+  }
+}
@@ -0,0 +1,79 @@
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Batch.hpp"
+#include "Rover/Constant.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/LogUniform.hpp"
+#include "Rover/Range.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_log_uniform", "[LogUniform]") {
+  auto scope = SeedScope(41);
+  SECTION("Distribution.") {
+    auto log_uniform = LogUniform(1E-6, 1.);
+    auto decades = std::array<int, 6>();
+    for(auto i = 0; i < 60000; ++i) {
+      auto value = generate(log_uniform);
+      REQUIRE(value >= 1E-6);
+      REQUIRE(value <= 1);
+      ++decades[std::min(5, static_cast<int>(-std::log10(value)))];
+    }
+    for(auto decade : decades) {
+      REQUIRE(decade > 9500);
+      REQUIRE(decade < 10500);
+    }
+  }
+  SECTION("Integral.") {
+    auto log_uniform = LogUniform(1, 10, Interval::OPEN);
+    for(auto i = 0; i < 1000; ++i) {
+      auto value = generate(log_uniform);
+      REQUIRE(value >= 2);
+      REQUIRE(value <= 9);
+    }
+  }
+  SECTION("Granularity.") {
+    auto log_uniform = LogUniform(16, 4096, 16);
+    for(auto i = 0; i < 1000; ++i) {
+      auto value = generate(log_uniform);
+      REQUIRE(value >= 16);
+      REQUIRE(value <= 4096);
+      REQUIRE(value % 16 == 0);
+    }
+  }
+  SECTION("No admissible value.") {
+    auto granular = LogUniform(1., 2., 5.);
+    auto range = Range(1., 2., 5.);
+    REQUIRE(generate(granular) == generate(range));
+    auto integral = LogUniform(3, 4, Interval::OPEN);
+    REQUIRE(generate(integral) == 3);
+    auto values = std::vector<double>();
+    generate_batch(granular, 10, std::back_inserter(values));
+    REQUIRE(values == std::vector<double>(10, 0.));
+  }
+  SECTION("Batch.") {
+    REQUIRE(is_batchable_v<LogUniform<Constant<double>, Constant<double>>>);
+    auto log_uniform = LogUniform(1., 1E4, Interval::RIGHT_EXCLUSIVE);
+    auto values = std::vector<double>();
+    generate_batch(log_uniform, 40001, std::back_inserter(values));
+    REQUIRE(values.size() == 40001);
+    auto below = 0;
+    for(auto value : values) {
+      REQUIRE(value >= 1);
+      REQUIRE(value < 1E4);
+      below += value < 100;
+    }
+    REQUIRE(below / 40001. == Approx(0.5).epsilon(0.03));
+  }
+  SECTION("Transform.") {
+    auto log_uniform = LogUniform(1., 100.);
+    auto evaluator = Evaluator();
+    REQUIRE(log_uniform.transform(evaluator, 0) == 1);
+    REQUIRE(log_uniform.transform(evaluator, 0.5) == Approx(10));
+    auto open = LogUniform(1, 100, Interval::OPEN);
+    REQUIRE(open.transform(evaluator, 0) == 2);
+  }
+}
@@ -0,0 +1,67 @@
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <catch2/catch.hpp>
+#include "Rover/BinaryCodec.hpp"
+#include "Rover/ListTrial.hpp"
+#include "Rover/MappedTrial.hpp"
+#include "Rover/Sample.hpp"
+#include "Rover/TrialView.hpp"
+
+using namespace Rover;
+
+namespace {
+  const auto PATH = "mapped_trial_tester.bin";
+
+  template<typename Trial>
+  void save(const Trial& trial) {
+    auto file = std::ofstream(PATH, std::ios::binary);
+    save_to_binary(trial, file);
+  }
+}
+
+TEST_CASE("test_mapped_trial", "[MappedTrial]") {
+  SECTION("Empty trial.") {
+    save(ListTrial<Sample<double, int, char>>());
+    auto trial = MappedTrial<Sample<double, int, char>>(PATH);
+    REQUIRE(trial.size() == 0);
+    REQUIRE(trial.begin() == trial.end());
+  }
+  SECTION("Samples.") {
+    auto list = ListTrial<Sample<double, int, char>>();
+    for(auto i = 0; i != 1000; ++i) {
+      list.insert({ 0.5 * i, { i, static_cast<char>('a' + i % 26) } });
+    }
+    save(list);
+    auto trial = MappedTrial<Sample<double, int, char>>(PATH);
+    REQUIRE(trial.size() == 1000);
+    REQUIRE(trial[999].m_result == 499.5);
+    REQUIRE(std::get<0>(trial[999].m_arguments) == 999);
+    REQUIRE(std::get<1>(trial[999].m_arguments) == 'l');
+    auto count = 0;
+    for(auto& sample : trial) {
+      REQUIRE(sample.m_result == 0.5 * count);
+      REQUIRE(std::get<0>(sample.m_arguments) == count);
+      ++count;
+    }
+    REQUIRE(count == 1000);
+    REQUIRE(&*(trial.begin() + 10) == &trial[10]);
+    auto view = TrialView(trial);
+    REQUIRE(view[3].m_result == 1.5);
+    auto moved = std::move(trial);
+    REQUIRE(moved[1].m_result == 0.5);
+  }
+  SECTION("Errors.") {
+    REQUIRE_THROWS_AS((MappedTrial<Sample<double, int>>(
+      "missing_mapped_trial.bin")), std::runtime_error);
+    auto list = ListTrial<Sample<double, int>>();
+    list.insert({ 0.5, { 7 } });
+    save(list);
+    REQUIRE_THROWS_AS((MappedTrial<Sample<double, float>>(PATH)),
+      std::runtime_error);
+    std::ofstream(PATH, std::ios::binary) << "5,7";
+    REQUIRE_THROWS_AS((MappedTrial<Sample<double, int>>(PATH)),
+      std::runtime_error);
+  }
+  std::remove(PATH);
+}
@@ -0,0 +1,106 @@
+#include <cmath>
+#include <iterator>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Batch.hpp"
+#include "Rover/Constant.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/Halton.hpp"
+#include "Rover/Normal.hpp"
+#include "Rover/Range.hpp"
+
+using namespace Rover;
+
+namespace {
+  template<typename T>
+  std::tuple<double, double> moments(const std::vector<T>& values) {
+    auto mean = 0.;
+    for(auto value : values) {
+      mean += value;
+    }
+    mean /= values.size();
+    auto variance = 0.;
+    for(auto value : values) {
+      variance += (value - mean) * (value - mean);
+    }
+    return {mean, variance / (values.size() - 1)};
+  }
+}
+
+TEST_CASE("test_normal_quantile", "[Normal]") {
+  SECTION("Inverse.") {
+    for(auto x = -8.; x <= 3.; x += 0.25) {
+      REQUIRE(Details::normal_quantile(Details::normal_cdf(x)) ==
+        Approx(x).margin(1E-9));
+    }
+  }
+  SECTION("Tails.") {
+    REQUIRE(Details::normal_quantile(0.5) == Approx(0).margin(1E-15));
+    REQUIRE(Details::normal_quantile(0.975) == Approx(1.959963984540054));
+    REQUIRE(Details::normal_quantile(1E-300) == Approx(-37.0471));
+    REQUIRE(std::isinf(Details::normal_quantile(0)));
+    REQUIRE(std::isinf(Details::normal_quantile(1)));
+  }
+}
+
+TEST_CASE("test_normal", "[Normal]") {
+  auto scope = SeedScope(31);
+  SECTION("Generate.") {
+    auto normal = Normal(3, 2);
+    auto values = std::vector<double>();
+    for(auto i = 0; i < 100000; ++i) {
+      values.push_back(generate(normal));
+    }
+    auto [mean, variance] = moments(values);
+    REQUIRE(mean == Approx(3).margin(0.03));
+    REQUIRE(variance == Approx(4).epsilon(0.02));
+  }
+  SECTION("Batch.") {
+    REQUIRE(is_batchable_v<Normal<Constant<double>, Constant<double>>>);
+    auto normal = Normal(-1., 0.5);
+    auto values = std::vector<double>();
+    generate_batch(normal, 100003, std::back_inserter(values));
+    REQUIRE(values.size() == 100003);
+    auto [mean, variance] = moments(values);
+    REQUIRE(mean == Approx(-1).margin(0.01));
+    REQUIRE(variance == Approx(0.25).epsilon(0.02));
+  }
+  SECTION("Batch distribution.") {
+    auto normal = Normal(0., 1.);
+    auto values = std::vector<double>();
+    generate_batch(normal, 1000000, std::back_inserter(values));
+    for(auto bound : {-3.5, -2., -1., -0.25, 0., 0.5, 1.5, 3.}) {
+      auto below = 0;
+      for(auto value : values) {
+        below += value < bound;
+      }
+      REQUIRE(below / 1E6 == Approx(Details::normal_cdf(bound)).margin(
+        0.0015));
+    }
+  }
+  SECTION("Batch parameters.") {
+    auto normal = Normal(Range(0, 1), 0.);
+    auto values = std::vector<double>();
+    generate_batch(normal, 1000, std::back_inserter(values));
+    auto zeros = 0;
+    for(auto value : values) {
+      REQUIRE((value == 0 || value == 1));
+      zeros += value == 0;
+    }
+    REQUIRE(zeros > 400);
+    REQUIRE(zeros < 600);
+  }
+  SECTION("Quasi-random.") {
+    auto halton = Halton(Normal(0., 1.));
+    halton.seek(1);
+    auto values = std::vector<double>();
+    for(auto i = 0; i < 1024; ++i) {
+      auto value = std::get<0>(generate(halton));
+      REQUIRE(std::isfinite(value));
+      values.push_back(value);
+    }
+    auto [mean, variance] = moments(values);
+    REQUIRE(mean == Approx(0).margin(0.02));
+    REQUIRE(variance == Approx(1).epsilon(0.05));
+  }
+}
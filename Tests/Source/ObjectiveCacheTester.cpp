@@ -0,0 +1,97 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/ObjectiveCache.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_objective_cache", "[ObjectiveCache]") {
+  SECTION("Lookups.") {
+    auto cache = ObjectiveCache<std::tuple<int, std::string>, double>(8);
+    REQUIRE(cache.capacity() == 8);
+    REQUIRE(!cache.find({1, "a"}));
+    cache.insert({1, "a"}, 1.5);
+    REQUIRE(cache.find({1, "a"}) == 1.5);
+    REQUIRE(!cache.find({1, "b"}));
+    cache.insert({1, "a"}, 2.5);
+    REQUIRE(cache.find({1, "a"}) == 2.5);
+    REQUIRE(cache.size() == 1);
+    auto statistics = cache.get_statistics();
+    REQUIRE(statistics.m_hits == 2);
+    REQUIRE(statistics.m_misses == 2);
+    REQUIRE(statistics.m_evictions == 0);
+    REQUIRE(statistics.get_hit_rate() == 0.5);
+    cache.reset_statistics();
+    REQUIRE(cache.get_statistics().get_hit_rate() == 0);
+    cache.clear();
+    REQUIRE(cache.size() == 0);
+    REQUIRE(!cache.find({1, "a"}));
+  }
+  SECTION("Least recently used.") {
+    auto cache = ObjectiveCache<std::tuple<int>, int>(1);
+    cache.insert({1}, 10);
+    cache.insert({2}, 20);
+    REQUIRE(!cache.find({1}));
+    REQUIRE(cache.find({2}) == 20);
+    REQUIRE(cache.get_statistics().m_evictions == 1);
+    auto shared = ObjectiveCache<std::tuple<int>, int>(64);
+    for(auto i = 0; i < 64; ++i) {
+      shared.insert({i}, i);
+    }
+    REQUIRE(shared.size() <= 64);
+    for(auto i = 0; i < 64; ++i) {
+      shared.find({i});
+    }
+    for(auto i = 64; i < 1000; ++i) {
+      shared.insert({i}, i);
+      REQUIRE(shared.size() <= 64);
+    }
+    for(auto i = 936; i < 1000; ++i) {
+      if(shared.find({i - 900})) {
+        FAIL("An old result was kept.");
+      }
+    }
+  }
+  SECTION("Get.") {
+    auto cache = ObjectiveCache<std::tuple<int, int>, int>(16);
+    auto calls = 0;
+    auto add = [&](int x, int y) {
+      ++calls;
+      return x + y;
+    };
+    REQUIRE(cache.get({1, 2}, add) == 3);
+    REQUIRE(cache.get({1, 2}, add) == 3);
+    REQUIRE(cache.get({2, 1}, add) == 3);
+    REQUIRE(calls == 2);
+  }
+  SECTION("Concurrency.") {
+    auto cache = ObjectiveCache<std::tuple<int>, int>(256);
+    auto calls = std::atomic<int>(0);
+    auto workers = std::vector<std::thread>();
+    for(auto i = 0; i < 4; ++i) {
+      workers.emplace_back([&] {
+        for(auto j = 0; j < 10000; ++j) {
+          auto key = j % 100;
+          auto result = cache.get({key}, [&](int x) {
+            ++calls;
+            return 2 * x;
+          });
+          if(result != 2 * key) {
+            FAIL("Wrong result.");
+          }
+        }
+      });
+    }
+    for(auto& worker : workers) {
+      worker.join();
+    }
+    REQUIRE(calls >= 100);
+    REQUIRE(calls <= 400);
+    auto statistics = cache.get_statistics();
+    REQUIRE(statistics.m_hits + statistics.m_misses == 40000);
+    REQUIRE(statistics.get_hit_rate() > 0.99);
+  }
+}
@@ -39,3 +39,37 @@ TEST_CASE("test_pick_variable_index", "[Pick]") {
   REQUIRE(generate(pick) == 7);
   REQUIRE(generate(pick) == 3);
 }
+
+TEST_CASE("test_pick_many_generators", "[Pick]") {
+  SECTION("Common type.") {
+    auto pick = Pick(Constant(1), Constant(3), Constant(5.5));
+    REQUIRE(generate(pick) == 5.5);
+  }
+  SECTION("Every index.") {
+    auto i = 0;
+    auto pick = Pick(Lift([&] {
+      return i++;
+    }), Constant(0), Constant(1), Constant(2), Constant(3), Constant(4),
+      Constant(5), Constant(6), Constant(7), Constant(8), Constant(9),
+      Constant(10), Constant(11), Constant(12), Constant(13), Constant(14),
+      Constant(15));
+    for(auto j = 0; j < 16; ++j) {
+      REQUIRE(generate(pick) == j);
+    }
+  }
+}
+
+TEST_CASE("test_pick_out_of_range_index", "[Pick]") {
+  SECTION("Negative index.") {
+    auto pick = Pick(Constant(-1), Constant(3), Constant(5));
+    REQUIRE(generate(pick) == 3);
+  }
+  SECTION("Index past the last generator.") {
+    auto pick = Pick(Constant(2), Constant(3), Constant(5));
+    REQUIRE(generate(pick) == 3);
+  }
+  SECTION("Unsigned index.") {
+    auto pick = Pick(Constant(7u), Constant(3), Constant(5));
+    REQUIRE(generate(pick) == 3);
+  }
+}
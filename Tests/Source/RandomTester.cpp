@@ -0,0 +1,97 @@
+#include <set>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Generator.hpp"
+#include "Rover/Random.hpp"
+#include "Rover/Range.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_philox_engine", "[Random]") {
+  SECTION("Known answer.") {
+    auto engine = PhiloxEngine(0);
+    REQUIRE(engine() == 0x6627E8D5);
+    REQUIRE(engine() == 0xE169C58D);
+    REQUIRE(engine() == 0xBC57AC4C);
+    REQUIRE(engine() == 0x9B00DBD8);
+  }
+  SECTION("Discard.") {
+    for(auto skip : {0ULL, 1ULL, 3ULL, 4ULL, 5ULL, 1000ULL}) {
+      auto engine = PhiloxEngine(7, 3);
+      auto skipped = PhiloxEngine(7, 3);
+      for(auto i = 0ULL; i < skip; ++i) {
+        engine();
+      }
+      skipped.discard(skip);
+      REQUIRE(engine == skipped);
+      for(auto i = 0; i < 10; ++i) {
+        REQUIRE(engine() == skipped());
+      }
+    }
+  }
+  SECTION("Streams.") {
+    auto first = PhiloxEngine(7, 0);
+    auto second = PhiloxEngine(7, 1);
+    auto differences = 0;
+    for(auto i = 0; i < 100; ++i) {
+      if(first() != second()) {
+        ++differences;
+      }
+    }
+    REQUIRE(differences > 90);
+  }
+  SECTION("Reseed.") {
+    auto engine = PhiloxEngine(11);
+    auto first = engine();
+    engine();
+    engine.seed(11);
+    REQUIRE(engine() == first);
+  }
+}
+
+TEST_CASE("test_seed_hierarchy", "[Random]") {
+  SECTION("Derive.") {
+    auto seeds = std::set<std::uint64_t>();
+    for(auto i = std::uint64_t(0); i < 1000; ++i) {
+      seeds.insert(derive_seed(5, i));
+    }
+    REQUIRE(seeds.size() == 1000);
+    REQUIRE(derive_seed(5, 3) == derive_seed(5, 3));
+    REQUIRE(derive_seed(5, 3) != derive_seed(6, 3));
+  }
+  SECTION("Root seed.") {
+    set_root_seed(13);
+    auto first = std::vector{next_seed(), next_seed()};
+    set_root_seed(13);
+    auto second = std::vector{next_seed(), next_seed()};
+    REQUIRE(first == second);
+    REQUIRE(first[0] != first[1]);
+  }
+  SECTION("Scopes.") {
+    auto outer = std::uint64_t();
+    auto inner = std::uint64_t();
+    {
+      auto scope = SeedScope(17);
+      outer = next_seed();
+      {
+        auto scope = SeedScope(19);
+        inner = next_seed();
+      }
+      REQUIRE(next_seed() == derive_seed(17, 1));
+    }
+    REQUIRE(outer == derive_seed(17, 0));
+    REQUIRE(inner == derive_seed(19, 0));
+  }
+  SECTION("Reproducible ranges.") {
+    auto sample = [] {
+      auto scope = SeedScope(23);
+      auto range = Range(0., 1.);
+      auto values = std::vector<double>();
+      for(auto i = 0; i < 100; ++i) {
+        values.push_back(generate(range));
+      }
+      return values;
+    };
+    REQUIRE(sample() == sample());
+  }
+}
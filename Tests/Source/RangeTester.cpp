@@ -1,3 +1,4 @@
+#include <array>
 #include <cmath>
 #include <type_traits>
 #include <catch2/catch.hpp>
@@ -166,3 +167,75 @@ TEST_CASE("test_pointer_arguments", "[Range]") {
     }
   }
 }
+
+TEST_CASE("test_range_distribution", "[Range]") {
+  SECTION("Integer endpoints.") {
+    auto range = Range(-2, 2);
+    auto counts = std::array<int, 5>();
+    for(auto i = 0; i < 5000; ++i) {
+      auto result = generate(range);
+      REQUIRE(result >= -2);
+      REQUIRE(result <= 2);
+      ++counts[result + 2];
+    }
+    for(auto count : counts) {
+      REQUIRE(count > 800);
+      REQUIRE(count < 1200);
+    }
+  }
+  SECTION("Integer open.") {
+    auto range = Range(0, 2, Interval::OPEN);
+    for(auto i = 0; i < 100; ++i) {
+      REQUIRE(generate(range) == 1);
+    }
+  }
+  SECTION("Unsigned.") {
+    auto range = Range(0U, 3U, Interval::RIGHT_EXCLUSIVE);
+    for(auto i = 0; i < 100; ++i) {
+      REQUIRE(generate(range) < 3U);
+    }
+  }
+  SECTION("Granular exclusive.") {
+    auto range = Range(0, 10, 5, Interval::OPEN);
+    for(auto i = 0; i < 100; ++i) {
+      REQUIRE(generate(range) == 5);
+    }
+  }
+  SECTION("Granular negative.") {
+    auto range = Range(-7, 7, 3);
+    auto counts = std::array<int, 5>();
+    for(auto i = 0; i < 5000; ++i) {
+      auto result = generate(range);
+      REQUIRE(result % 3 == 0);
+      REQUIRE(result >= -6);
+      REQUIRE(result <= 6);
+      ++counts[result / 3 + 2];
+    }
+    for(auto count : counts) {
+      REQUIRE(count > 800);
+      REQUIRE(count < 1200);
+    }
+  }
+  SECTION("Float open.") {
+    auto range = Range(0., std::nextafter(0., 1.) * 2, Interval::OPEN);
+    for(auto i = 0; i < 100; ++i) {
+      REQUIRE(generate(range) == std::nextafter(0., 1.));
+    }
+  }
+  SECTION("Float closed.") {
+    auto range = Range(1.f, 2.f);
+    for(auto i = 0; i < 1000; ++i) {
+      auto result = generate(range);
+      REQUIRE(result >= 1.f);
+      REQUIRE(result <= 2.f);
+    }
+  }
+  SECTION("Empty open.") {
+    auto integer_range = Range(3, 4, Interval::OPEN);
+    auto float_range = Range(1., std::nextafter(1., 2.), Interval::OPEN);
+    for(auto i = 0; i < 100; ++i) {
+      REQUIRE(generate(integer_range) == 3);
+      REQUIRE(generate(float_range) == 1.);
+    }
+  }
+}
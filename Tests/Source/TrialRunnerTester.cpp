@@ -0,0 +1,241 @@
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <catch2/catch.hpp>
+#include "Rover/Constant.hpp"
+#include "Rover/Grid.hpp"
+#include "Rover/Halton.hpp"
+#include "Rover/LatinHypercube.hpp"
+#include "Rover/Range.hpp"
+#include "Rover/TrialRunner.hpp"
+
+using namespace Rover;
+
+namespace {
+  struct Point {
+    int m_x;
+    int m_y;
+  };
+}
+
+TEST_CASE("test_trial_runner", "[TrialRunner]") {
+  SECTION("Samples.") {
+    auto runner = TrialRunner([] {
+        return std::tuple(Range(0, 100), Range(0, 100));
+      }, [](int x, int y) {
+        return x + y;
+      }, 4);
+    REQUIRE(runner.concurrency() == 4);
+    auto trial = runner.run(1000);
+    REQUIRE(trial.size() == 1000);
+    for(auto& sample : trial) {
+      auto [x, y] = sample.m_arguments;
+      REQUIRE(x >= 0);
+      REQUIRE(x <= 100);
+      REQUIRE(y >= 0);
+      REQUIRE(y <= 100);
+      REQUIRE(sample.m_result == x + y);
+    }
+  }
+  SECTION("Appends.") {
+    auto runner = TrialRunner([] {
+        return std::tuple(Constant(3));
+      }, [](int x) {
+        return 2 * x;
+      }, 3);
+    auto trial = ListTrial<Sample<int, int>>();
+    runner.run(10, trial);
+    runner.run(5, trial);
+    REQUIRE(trial.size() == 15);
+    for(auto& sample : trial) {
+      REQUIRE(sample.m_result == 6);
+      REQUIRE(std::get<0>(sample.m_arguments) == 3);
+    }
+  }
+  SECTION("Empty.") {
+    auto runner = TrialRunner([] {
+        return std::tuple(Constant(3));
+      }, [](int x) {
+        return x;
+      }, 2);
+    REQUIRE(runner.run(0).size() == 0);
+  }
+}
+
+TEST_CASE("test_trial_runner_unhashable", "[TrialRunner]") {
+  static_assert(!is_cacheable_v<std::tuple<int, Point>>);
+  auto runner = TrialRunner([] {
+      return std::tuple(Constant(2), Constant(Point{3, 4}));
+    }, [](int scale, const Point& point) {
+      return scale * (point.m_x + point.m_y);
+    }, 2);
+  auto trial = runner.run(10);
+  REQUIRE(trial.size() == 10);
+  for(auto& sample : trial) {
+    REQUIRE(sample.m_result == 14);
+  }
+  REQUIRE(runner.get_cache() == nullptr);
+}
+
+TEST_CASE("test_trial_runner_workers", "[TrialRunner]") {
+  SECTION("Replicas.") {
+    auto builds = std::atomic<int>(0);
+    auto runner = TrialRunner([&] {
+        ++builds;
+        return std::tuple(Constant(1));
+      }, [](int x) {
+        return x;
+      }, 4);
+    runner.run(4 * RUNNER_CHUNK_COUNT);
+    REQUIRE(builds == RUNNER_CHUNK_COUNT);
+  }
+  SECTION("Threads.") {
+    auto mutex = std::mutex();
+    auto threads = std::set<std::thread::id>();
+    auto runner = TrialRunner([] {
+        return std::tuple(Constant(1));
+      }, [&](int x) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        auto lock = std::lock_guard(mutex);
+        threads.insert(std::this_thread::get_id());
+        return x;
+      }, 4);
+    runner.run(64);
+    REQUIRE(threads.size() > 1);
+    REQUIRE(threads.size() <= 4);
+  }
+  SECTION("Exception.") {
+    auto runner = TrialRunner([] {
+        return std::tuple(Range(0, 100));
+      }, [](int x) {
+        if(x > 50) {
+          throw std::runtime_error("Out of range.");
+        }
+        return x;
+      }, 4);
+    auto trial = ListTrial<Sample<int, int>>();
+    REQUIRE_THROWS_AS(runner.run(1000, trial), std::runtime_error);
+    REQUIRE(trial.size() == 0);
+  }
+}
+
+TEST_CASE("test_trial_runner_ordered", "[TrialRunner]") {
+  SECTION("Halton.") {
+    auto runner = TrialRunner([] {
+        return std::tuple(Halton(Range(0., 1.), Range(0., 1.)));
+      }, [](const std::tuple<double, double>& point) {
+        return std::get<0>(point);
+      }, 4);
+    auto trial = runner.run(1000);
+    auto points = std::set<std::tuple<double, double>>();
+    for(auto& sample : trial) {
+      points.insert(std::get<0>(sample.m_arguments));
+    }
+    REQUIRE(points.size() == 1000);
+  }
+  SECTION("Grid.") {
+    auto runner = TrialRunner([] {
+        return std::tuple(Grid(Range(0, 9), Range(0, 99)));
+      }, [](const std::tuple<int, int>& point) {
+        return std::get<0>(point);
+      }, 4);
+    auto trial = runner.run(1000);
+    auto points = std::set<std::tuple<int, int>>();
+    for(auto& sample : trial) {
+      points.insert(std::get<0>(sample.m_arguments));
+    }
+    REQUIRE(points.size() == 1000);
+  }
+  SECTION("LatinHypercube.") {
+    auto runner = TrialRunner([] {
+        auto scope = SeedScope(7);
+        return std::tuple(LatinHypercube(1000, Range(0., 1.)));
+      }, [](const std::tuple<double>& point) {
+        return std::get<0>(point);
+      }, 4);
+    auto trial = runner.run(1000);
+    auto strata = std::set<int>();
+    for(auto& sample : trial) {
+      strata.insert(static_cast<int>(sample.m_result * 1000));
+    }
+    REQUIRE(strata.size() == 1000);
+  }
+}
+
+TEST_CASE("test_trial_runner_seed", "[TrialRunner]") {
+  auto build = [] {
+    return std::tuple(Range(0, 1000000), Range(0., 1.));
+  };
+  auto function = [](int x, double y) {
+    return x * y;
+  };
+  auto first = TrialRunner(build, function, 1);
+  auto second = TrialRunner(build, function, 4);
+  first.seed(42);
+  second.seed(42);
+  for(auto i = 0; i < 2; ++i) {
+    auto first_trial = first.run(1000);
+    auto second_trial = second.run(1000);
+    REQUIRE(first_trial.size() == second_trial.size());
+    for(auto j = std::size_t(0); j < first_trial.size(); ++j) {
+      REQUIRE(first_trial[j].m_arguments == second_trial[j].m_arguments);
+      REQUIRE(first_trial[j].m_result == second_trial[j].m_result);
+    }
+  }
+  auto third = TrialRunner(build, function, 4);
+  third.seed(43);
+  auto first_trial = first.run(100);
+  auto third_trial = third.run(100);
+  auto differences = 0;
+  for(auto j = std::size_t(0); j < first_trial.size(); ++j) {
+    if(first_trial[j].m_arguments != third_trial[j].m_arguments) {
+      ++differences;
+    }
+  }
+  REQUIRE(differences > 90);
+}
+
+TEST_CASE("test_trial_runner_cache", "[TrialRunner]") {
+  SECTION("Record hits.") {
+    auto calls = std::atomic<int>(0);
+    auto runner = TrialRunner([] {
+        return std::tuple(Range(0, 3), Range(0, 1));
+      }, [&](int x, int y) {
+        ++calls;
+        return 2 * x + y;
+      }, 4);
+    REQUIRE(runner.get_cache() == nullptr);
+    runner.enable_cache(64);
+    auto trial = runner.run(1000);
+    REQUIRE(trial.size() == 1000);
+    for(auto& sample : trial) {
+      auto [x, y] = sample.m_arguments;
+      REQUIRE(sample.m_result == 2 * x + y);
+    }
+    REQUIRE(calls >= 8);
+    REQUIRE(calls <= 8 * 4);
+    auto statistics = runner.get_cache()->get_statistics();
+    REQUIRE(statistics.m_hits + statistics.m_misses == 1000);
+    REQUIRE(statistics.m_misses == static_cast<std::uint64_t>(calls.load()));
+    runner.run(100);
+    REQUIRE(runner.get_cache()->get_statistics().m_hits ==
+      statistics.m_hits + 100);
+  }
+  SECTION("Skip hits.") {
+    auto runner = TrialRunner([] {
+        return std::tuple(Range(0, 9));
+      }, [](int x) {
+        return x;
+      }, 1);
+    runner.enable_cache(16, false);
+    auto trial = runner.run(500);
+    REQUIRE(trial.size() == 10);
+    REQUIRE(runner.get_cache()->get_statistics().m_misses == 10);
+    runner.disable_cache();
+    REQUIRE(runner.run(20).size() == 20);
+  }
+}
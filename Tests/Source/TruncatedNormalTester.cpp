@@ -0,0 +1,78 @@
+#include <iterator>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Batch.hpp"
+#include "Rover/Constant.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/Range.hpp"
+#include "Rover/TruncatedNormal.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_truncated_normal", "[TruncatedNormal]") {
+  auto scope = SeedScope(43);
+  SECTION("Moments.") {
+    auto normal = TruncatedNormal(0., 1., -1., 1.);
+    auto sum = 0.;
+    auto squares = 0.;
+    for(auto i = 0; i < 100000; ++i) {
+      auto value = generate(normal);
+      REQUIRE(value >= -1);
+      REQUIRE(value <= 1);
+      sum += value;
+      squares += value * value;
+    }
+    REQUIRE(sum / 100000 == Approx(0).margin(0.01));
+    REQUIRE(squares / 100000 == Approx(0.2911).epsilon(0.02));
+  }
+  SECTION("Tail.") {
+    auto normal = TruncatedNormal(0., 1., 8., 9.);
+    auto sum = 0.;
+    for(auto i = 0; i < 10000; ++i) {
+      auto value = generate(normal);
+      REQUIRE(value >= 8);
+      REQUIRE(value <= 9);
+      sum += value;
+    }
+    REQUIRE(sum / 10000 == Approx(8.1226).epsilon(0.002));
+    auto lower = TruncatedNormal(0., 1., -9., -8.);
+    REQUIRE(generate(lower) <= -8);
+  }
+  SECTION("Granularity.") {
+    auto normal = TruncatedNormal(50, 20, 0, 100, 5, Interval::OPEN);
+    for(auto i = 0; i < 1000; ++i) {
+      auto value = generate(normal);
+      REQUIRE(value >= 5);
+      REQUIRE(value <= 95);
+      REQUIRE(value % 5 == 0);
+    }
+  }
+  SECTION("No admissible value.") {
+    auto granular = TruncatedNormal(1.5, 1., 1., 2., 5.);
+    auto range = Range(1., 2., 5.);
+    REQUIRE(generate(granular) == generate(range));
+    auto integral = TruncatedNormal(3.5, 1., 3, 4, Interval::OPEN);
+    REQUIRE(generate(integral) == 3);
+  }
+  SECTION("Batch.") {
+    REQUIRE(is_batchable_v<TruncatedNormal<Constant<double>,
+      Constant<double>, Constant<double>, Constant<double>>>);
+    auto normal = TruncatedNormal(Range(0, 1), 1., 0., 2.);
+    auto values = std::vector<double>();
+    generate_batch(normal, 50001, std::back_inserter(values));
+    REQUIRE(values.size() == 50001);
+    auto sum = 0.;
+    for(auto value : values) {
+      REQUIRE(value >= 0);
+      REQUIRE(value <= 2);
+      sum += value;
+    }
+    REQUIRE(sum / values.size() == Approx(0.8614).epsilon(0.02));
+  }
+  SECTION("Transform.") {
+    auto normal = TruncatedNormal(0., 1., -1., 1.);
+    auto evaluator = Evaluator();
+    REQUIRE(normal.transform(evaluator, 0) == -1);
+    REQUIRE(normal.transform(evaluator, 0.5) == Approx(0).margin(1E-12));
+  }
+}
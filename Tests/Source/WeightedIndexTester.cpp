@@ -0,0 +1,103 @@
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "Rover/Batch.hpp"
+#include "Rover/Constant.hpp"
+#include "Rover/Generator.hpp"
+#include "Rover/Select.hpp"
+#include "Rover/WeightedIndex.hpp"
+#include "Rover/WeightedRandomPick.hpp"
+
+using namespace Rover;
+
+TEST_CASE("test_weighted_index", "[WeightedIndex]") {
+  SECTION("Frequencies.") {
+    auto index = WeightedIndex({1., 0., 3., 6.});
+    auto counts = std::array<int, 4>();
+    for(auto i = 0; i < 10000; ++i) {
+      ++counts[generate(index)];
+    }
+    REQUIRE(counts[0] > 800);
+    REQUIRE(counts[0] < 1200);
+    REQUIRE(counts[1] == 0);
+    REQUIRE(counts[2] > 2700);
+    REQUIRE(counts[2] < 3300);
+    REQUIRE(counts[3] > 5600);
+    REQUIRE(counts[3] < 6400);
+  }
+  SECTION("Single.") {
+    auto weights = std::vector<double>(10000, 0.);
+    weights[7777] = 1.;
+    auto index = WeightedIndex(std::move(weights));
+    REQUIRE(index.size() == 10000);
+    for(auto i = 0; i < 100; ++i) {
+      REQUIRE(generate(index) == 7777);
+    }
+  }
+  SECTION("Update.") {
+    auto index = WeightedIndex(std::vector<double>(1000, 1.));
+    for(auto i = std::size_t(0); i < index.size(); ++i) {
+      if(i != 123 && i != 456) {
+        index.set_weight(i, 0.);
+      }
+    }
+    index.set_weight(456, 3.);
+    REQUIRE(index.get_weight(456) == 3.);
+    auto counts = std::array<int, 2>();
+    auto values = std::vector<int>();
+    generate_batch(index, 4000, std::back_inserter(values));
+    for(auto value : values) {
+      REQUIRE((value == 123 || value == 456));
+      ++counts[value == 456];
+    }
+    REQUIRE(counts[0] > 800);
+    REQUIRE(counts[0] < 1200);
+  }
+}
+
+TEST_CASE("test_weighted_index_errors", "[WeightedIndex]") {
+  SECTION("No weights.") {
+    REQUIRE_THROWS_AS(WeightedIndex({}), std::invalid_argument);
+  }
+  SECTION("Weights and generators.") {
+    REQUIRE_THROWS_AS(WeightedRandomPick({1., 1., 1.}, Constant(1),
+      Constant(2)), std::invalid_argument);
+  }
+  SECTION("Weights and container.") {
+    REQUIRE_THROWS_AS(Select(std::vector{Constant(1), Constant(2)},
+      WeightedIndex({1., 1., 1.})), std::invalid_argument);
+    REQUIRE_THROWS_AS(Select(std::vector{Constant(1), Constant(2)},
+      WeightedIndex({1.})), std::invalid_argument);
+  }
+}
+
+TEST_CASE("test_weighted_random_pick", "[WeightedIndex]") {
+  auto pick = WeightedRandomPick({0., 1.}, Constant(1), Constant(2));
+  for(auto i = 0; i < 100; ++i) {
+    REQUIRE(generate(pick) == 2);
+  }
+  pick.set_weight(0, 1.);
+  pick.set_weight(1, 0.);
+  REQUIRE(pick.get_weight(0) == 1.);
+  for(auto i = 0; i < 100; ++i) {
+    REQUIRE(generate(pick) == 1);
+  }
+}
+
+TEST_CASE("test_weighted_select", "[WeightedIndex]") {
+  auto select = Select(std::vector{Constant(std::string("a")),
+    Constant(std::string("b")), Constant(std::string("c"))},
+    WeightedIndex({0., 0., 1.}));
+  static_assert(std::is_same_v<decltype(select),
+    WeightedSelect<std::vector<Constant<std::string>>>>);
+  for(auto i = 0; i < 100; ++i) {
+    REQUIRE(generate(select) == "c");
+  }
+  select.get_selector().set_weight(0, 1.);
+  select.get_selector().set_weight(2, 0.);
+  for(auto i = 0; i < 100; ++i) {
+    REQUIRE(generate(select) == "a");
+  }
+}